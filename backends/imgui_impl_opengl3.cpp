@@ -6,6 +6,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [x] Renderer: Large meshes support (64k+ vertices) with 32-bit indices for large draw lists only (ImGuiBackendFlags_RendererHasIdx32, not on ES2/WebGL 1.0).
+//  [x] Renderer: Partial updates of font atlas texture (ImGuiBackendFlags_RendererHasTexUpdates), needed by ImFontAtlasFlags_DynamicGlyphs.
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +24,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2024-07-10: OpenGL: Set ImGuiBackendFlags_RendererHasTexUpdates flag, as we upload ImFontAtlas::TexDirtyRect.
+//  2024-07-08: OpenGL: Added support for ImDrawList::IdxBuffer32, enable ImGuiBackendFlags_RendererHasIdx32 flag (except on ES2): large meshes are drawn with 32-bit indices in a single draw call.
+//  2024-07-02: OpenGL: [BETA] Desktop GL 3.2+: '#define IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD' to upload vertex/index buffers of all draw lists in a single glBufferData() call per frame, skipped when unchanged. GL 4.4+ or GL_ARB_buffer_storage: '#define IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE' to upload into a persistently mapped ring buffer. Draw with base vertex/index offsets. Both disabled by default.
+//  2024-06-20: OpenGL: Upload dirty region of font atlas texture with glTexSubImage2D() when using ImFontAtlasFlags_DynamicGlyphs.
 //  2024-05-07: OpenGL: Update loader for Linux to support EGL/GLVND. (#7562)
 //  2024-04-16: OpenGL: Detect ES3 contexts on desktop based on version string, to e.g. avoid calling glPolygonMode() on them. (#7447)
 //  2024-01-09: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" and variants, fixing regression on distros missing a symlink.
@@ -200,6 +206,17 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
 #endif
 
+// [BETA] Desktop GL 3.2+: '#define IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD' to upload all draw lists with one glBufferData() per buffer and draw with base vertex.
+// [BETA] Desktop GL 4.4+: '#define IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE' to also upload into a persistently mapped ring buffer created with glBufferStorage() (also available with GL_ARB_buffer_storage).
+// Both are disabled by default until they get more testing on real drivers (see comments about glBufferSubData() in ImGui_ImplOpenGL3_RenderDrawData()).
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && (defined(IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD) || defined(IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE))
+#define IMGUI_IMPL_OPENGL_MAY_USE_SINGLE_UPLOAD
+#endif
+#if defined(IMGUI_IMPL_OPENGL_MAY_USE_SINGLE_UPLOAD) && defined(GL_VERSION_4_4) && defined(IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#define IMGUI_IMPL_OPENGL_RING_FRAMES   3       // Number of frames we can write to the ring buffer before waiting for the GPU
+#endif
+
 // Desktop GL 3.3+ and GL ES 3.0+ have glBindSampler()
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
@@ -231,11 +248,24 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
     unsigned int    VboHandle, ElementsHandle;
+    unsigned int    Elements32Handle;        // Single upload: 32-bit indices of draw lists using ImDrawList::IdxBuffer32, uploaded per draw list. Created on demand.
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            UseSingleUpload;         // Upload all draw lists with one glBufferData() per buffer and draw with base vertex (Desktop GL 3.2+, IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD)
+    bool            UseBufferStorage;        // Upload all draw lists into a persistently mapped ring buffer (Desktop GL 4.4+ or GL_ARB_buffer_storage, IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE)
+    ImVector<char>  UploadVtxBuffer;         // Single upload: concatenated vertices/indices of all draw lists, as last uploaded.
+    ImVector<char>  UploadIdxBuffer;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImDrawVert*     RingVtxMapped;           // Ring buffer: IMGUI_IMPL_OPENGL_RING_FRAMES regions of RingVtxCapacity vertices and RingIdxCapacity indices
+    ImDrawIdx*      RingIdxMapped;
+    int             RingVtxCapacity;
+    int             RingIdxCapacity;
+    int             RingFrameIndex;
+    GLsync          RingFences[IMGUI_IMPL_OPENGL_RING_FRAMES];
+#endif
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -339,6 +369,13 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_USE_SINGLE_UPLOAD
+    bd->UseSingleUpload = (bd->GlVersion >= 320);                    // Vertices of all draw lists can be addressed with glDrawElementsBaseVertex().
+#endif
+#ifndef IMGUI_IMPL_OPENGL_ES2
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32;          // We can honor the ImDrawList::IdxBuffer32 field (GL_UNSIGNED_INT indices are an extension on ES2), allowing for large meshes.
+#endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can honor the ImFontAtlas::TexDirtyRect field, allowing for ImFontAtlasFlags_DynamicGlyphs.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -368,6 +405,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     bd->HasPolygonMode = (!bd->GlProfileIsES2 && !bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    bd->UseBufferStorage = bd->UseSingleUpload && (bd->GlVersion >= 440);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -376,6 +416,10 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+        if (extension != nullptr && strcmp(extension, "GL_ARB_buffer_storage") == 0)
+            bd->UseBufferStorage = bd->UseSingleUpload;
+#endif
     }
 #endif
 
@@ -391,7 +435,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32 | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -478,11 +522,142 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+// Upload glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (!io.Fonts->IsTexDirty() || bd->FontTexture == 0)
+        return;
+
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    const int x0 = (int)io.Fonts->TexDirtyRect.x, y0 = (int)io.Fonts->TexDirtyRect.y;
+    const int x1 = (int)io.Fonts->TexDirtyRect.z, y1 = (int)io.Fonts->TexDirtyRect.w;
+
+    GLint last_texture;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, width));
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x0, y0, x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE, pixels + (y0 * width + x0) * 4));
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#else
+    IM_UNUSED(x0); IM_UNUSED(x1);
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y0, width, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE, pixels + y0 * width * 4));
+#endif
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+    io.Fonts->ClearTexDirty();
+}
+
+// Append data to a concatenated buffer which holds last uploaded data. Bytes are compared until the first difference, then copied.
+// Return true if the buffer contents were modified: when nothing changed, we can skip uploading altogether (e.g. idle application).
+static bool ImGui_ImplOpenGL3_UpdateUploadBuffer(ImVector<char>* buf, int* offset, const void* data, int size, bool changed)
+{
+    if (!changed)
+        changed = (*offset + size > buf->Size) || (size > 0 && memcmp(buf->Data + *offset, data, (size_t)size) != 0);
+    if (changed && size > 0)
+    {
+        if (buf->Size < *offset + size)
+            buf->resize(*offset + size);
+        memcpy(buf->Data + *offset, data, (size_t)size);
+    }
+    *offset += size;
+    return changed;
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+// Copy vertices/indices of all draw lists into contiguous buffers (no GL calls are made here).
+// Draw list N starts after vertices/indices of draw lists 0..N-1: this is the order used by the draw loop to compute base vertex/index offsets.
+static void ImGui_ImplOpenGL3_CopyDrawData(const ImDrawData* draw_data, ImDrawVert* vtx_dst, ImDrawIdx* idx_dst)
+{
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+    }
+}
+
+static void ImGui_ImplOpenGL3_DestroyRingBuffer()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (GLsync& fence : bd->RingFences)
+        if (fence) { glDeleteSync(fence); fence = nullptr; }
+    bd->RingVtxMapped = nullptr; // Buffers are unmapped when deleted
+    bd->RingIdxMapped = nullptr;
+    bd->RingVtxCapacity = bd->RingIdxCapacity = 0;
+}
+
+// Select the region of the ring buffer used by this frame, and output its offset in vertices/indices.
+// - Buffers are (re)created when too small, as storage created with glBufferStorage() can't be resized.
+// - We wait on the fence of the last frame which used this region, so we never overwrite data the GPU may still be reading.
+//   With IMGUI_IMPL_OPENGL_RING_FRAMES regions, this only blocks when the GPU is that many frames late.
+// - Our buffers are mapped once with GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT: writes don't need any GL call.
+static bool ImGui_ImplOpenGL3_SetupRingBuffer(ImDrawData* draw_data, int* out_vtx_offset, int* out_idx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->RingVtxMapped == nullptr || bd->RingVtxCapacity < draw_data->TotalVtxCount || bd->RingIdxCapacity < draw_data->TotalIdxCount)
+    {
+        ImGui_ImplOpenGL3_DestroyRingBuffer();
+        GL_CALL(glDeleteBuffers(1, &bd->VboHandle));
+        GL_CALL(glDeleteBuffers(1, &bd->ElementsHandle));
+        GL_CALL(glGenBuffers(1, &bd->VboHandle));
+        GL_CALL(glGenBuffers(1, &bd->ElementsHandle));
+
+        // We use the GL_ARRAY_BUFFER target for both buffers because GL_ELEMENT_ARRAY_BUFFER binding is part of the currently bound VAO.
+        // (GL_ARRAY_BUFFER binding is restored at the end of ImGui_ImplOpenGL3_RenderDrawData())
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const int vtx_capacity = draw_data->TotalVtxCount + 5000;
+        const int idx_capacity = draw_data->TotalIdxCount + 10000;
+        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)vtx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawVert);
+        const GLsizeiptr idx_buffer_size = (GLsizeiptr)idx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawIdx);
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+        GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, vtx_buffer_size, nullptr, flags));
+        bd->RingVtxMapped = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vtx_buffer_size, flags);
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ElementsHandle));
+        GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, idx_buffer_size, nullptr, flags));
+        bd->RingIdxMapped = (ImDrawIdx*)glMapBufferRange(GL_ARRAY_BUFFER, 0, idx_buffer_size, flags);
+        if (bd->RingVtxMapped == nullptr || bd->RingIdxMapped == nullptr)
+        {
+            // Mapping failed: give up on persistent mapping and use new buffers with mutable storage.
+            ImGui_ImplOpenGL3_DestroyRingBuffer();
+            GL_CALL(glDeleteBuffers(1, &bd->VboHandle));
+            GL_CALL(glDeleteBuffers(1, &bd->ElementsHandle));
+            GL_CALL(glGenBuffers(1, &bd->VboHandle));
+            GL_CALL(glGenBuffers(1, &bd->ElementsHandle));
+            bd->UseBufferStorage = false;
+            return false;
+        }
+        bd->RingVtxCapacity = vtx_capacity;
+        bd->RingIdxCapacity = idx_capacity;
+    }
+
+    bd->RingFrameIndex = (bd->RingFrameIndex + 1) % IMGUI_IMPL_OPENGL_RING_FRAMES;
+    if (GLsync fence = bd->RingFences[bd->RingFrameIndex])
+    {
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (result == GL_TIMEOUT_EXPIRED)
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+        glDeleteSync(fence);
+        bd->RingFences[bd->RingFrameIndex] = nullptr;
+    }
+    *out_vtx_offset = bd->RingFrameIndex * bd->RingVtxCapacity;
+    *out_idx_offset = bd->RingFrameIndex * bd->RingIdxCapacity;
+    return true;
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
 void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 {
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
     int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
     int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
@@ -530,6 +705,22 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    // Upload vertex/index buffers of all draw lists at once (Desktop GL 3.2+, with IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD or IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE)
+    // - With persistent mapping, copy straight into this frame's region of the ring buffer.
+    // - Otherwise concatenate into contiguous buffers, uploaded with a single glBufferData() each once our buffers are bound (below).
+    // Vertices/indices of draw list N follow those of draw lists 0..N-1, so we draw with base vertex/index offsets accumulated over draw lists.
+    // This replaces two glBufferData() calls per draw list, which are costly with hundreds of draw lists.
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    bool use_ring_buffer = false;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseBufferStorage && ImGui_ImplOpenGL3_SetupRingBuffer(draw_data, &global_vtx_offset, &global_idx_offset))
+    {
+        ImGui_ImplOpenGL3_CopyDrawData(draw_data, bd->RingVtxMapped + global_vtx_offset, bd->RingIdxMapped + global_idx_offset);
+        use_ring_buffer = true;
+    }
+#endif
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
@@ -539,6 +730,29 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // Single upload without persistent mapping: concatenate draw lists data, and skip uploading a buffer if it is identical to our last upload.
+    if (bd->UseSingleUpload && !use_ring_buffer)
+    {
+        int vtx_offset = 0, idx_offset = 0;
+        bool vtx_changed = false, idx_changed = false;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* cmd_list = draw_data->CmdLists[n];
+            vtx_changed = ImGui_ImplOpenGL3_UpdateUploadBuffer(&bd->UploadVtxBuffer, &vtx_offset, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.size_in_bytes(), vtx_changed);
+            idx_changed = ImGui_ImplOpenGL3_UpdateUploadBuffer(&bd->UploadIdxBuffer, &idx_offset, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.size_in_bytes(), idx_changed);
+        }
+        if (vtx_changed || vtx_offset != bd->UploadVtxBuffer.Size)
+        {
+            bd->UploadVtxBuffer.resize(vtx_offset);
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)vtx_offset, (const GLvoid*)bd->UploadVtxBuffer.Data, GL_STREAM_DRAW));
+        }
+        if (idx_changed || idx_offset != bd->UploadIdxBuffer.Size)
+        {
+            bd->UploadIdxBuffer.resize(idx_offset);
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)idx_offset, (const GLvoid*)bd->UploadIdxBuffer.Data, GL_STREAM_DRAW));
+        }
+    }
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
@@ -548,7 +762,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
 
-        // Upload vertex/index buffers
+        // Upload vertex/index buffers (when we can't upload all draw lists at once, see above)
         // - OpenGL drivers are in a very sorry state nowadays....
         //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
         //   of leaks on Intel GPU when using multi-viewports on Windows.
@@ -556,9 +770,25 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+        // - Large draw lists may use 32-bit indices (see ImGuiBackendFlags_RendererHasIdx32). With single upload, they are uploaded to their own buffer.
+        const bool use_idx32 = (cmd_list->IdxBuffer32.Size > 0);
+        const GLenum idx_type = (use_idx32 || sizeof(ImDrawIdx) == 4) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+        const int idx_size = use_idx32 ? (int)sizeof(ImU32) : (int)sizeof(ImDrawIdx);
+        const GLvoid* idx_buffer_data = use_idx32 ? (const GLvoid*)cmd_list->IdxBuffer32.Data : (const GLvoid*)cmd_list->IdxBuffer.Data;
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        const GLsizeiptr idx_buffer_size = (GLsizeiptr)(use_idx32 ? cmd_list->IdxBuffer32.Size : cmd_list->IdxBuffer.Size) * idx_size;
+        if (bd->UseSingleUpload)
+        {
+            // Already uploaded, except 32-bit indices
+            if (use_idx32)
+            {
+                if (bd->Elements32Handle == 0)
+                    GL_CALL(glGenBuffers(1, &bd->Elements32Handle));
+                GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->Elements32Handle));
+                GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer_data, GL_STREAM_DRAW));
+            }
+        }
+        else if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
             {
@@ -571,12 +801,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
             }
             GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data));
-            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data));
+            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, idx_buffer_data));
         }
         else
         {
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW));
-            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer_data, GL_STREAM_DRAW));
         }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
@@ -587,7 +817,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    if (use_idx32 && bd->UseSingleUpload)
+                        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->Elements32Handle));
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -606,14 +840,27 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)((pcmd->IdxOffset + (use_idx32 ? 0 : global_idx_offset)) * idx_size), (GLint)(pcmd->VtxOffset + global_vtx_offset)));
                 else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_size)));
             }
         }
+        if (bd->UseSingleUpload)
+        {
+            if (use_idx32)
+                GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
+            global_idx_offset += cmd_list->IdxBuffer.Size;
+            global_vtx_offset += cmd_list->VtxBuffer.Size;
+        }
     }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Signal when the GPU is done reading this frame's region of the ring buffer
+    if (use_ring_buffer)
+        bd->RingFences[bd->RingFrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
@@ -684,6 +931,7 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    io.Fonts->ClearTexDirty();
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
@@ -939,8 +1187,14 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyRingBuffer();
+#endif
+    bd->UploadVtxBuffer.clear();
+    bd->UploadIdxBuffer.clear();
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    if (bd->Elements32Handle) { glDeleteBuffers(1, &bd->Elements32Handle); bd->Elements32Handle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
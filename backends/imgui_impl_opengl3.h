@@ -44,6 +44,8 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
+//#define IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD    // [BETA] Upload vertices/indices of all draw lists at once (Desktop GL 3.2+)
+//#define IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE   // [BETA] Upload vertices/indices of all draw lists into a persistently mapped ring buffer (Desktop GL 4.4+, implies IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD)
 
 // You can explicitly select GLES2 or GLES3 API by using one of the '#define IMGUI_IMPL_OPENGL_LOADER_XXX' in imconfig.h or compiler command-line.
 #if !defined(IMGUI_IMPL_OPENGL_ES2) \
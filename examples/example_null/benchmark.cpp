@@ -0,0 +1,2349 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Replay canned workloads and report per-phase CPU timings, vertex/index counts and allocation counts.
+// This is used to catch CPU performance regressions on machines without a display (e.g. CI).
+//
+// Usage:
+//   example_null_bench [--frames N] [--warmup N] [--workload NAME[,NAME...]] [--format text|json|csv] [--threads N] [--list]
+//   example_null_bench --fonts [--threads N] [--font-file FILE.ttf]
+//   example_null_bench --glyphs [--font-file FILE.ttf]
+//   example_null_bench --idle
+//   example_null_bench --hover
+//   example_null_bench --idx32
+//   example_null_bench --opengl3
+//
+// Notes:
+// - Build with optimizations for meaningful numbers, e.g. 'make CXXFLAGS=-O2'.
+// - Each workload runs in its own context (sharing one font atlas), so state and allocations don't leak between workloads.
+// - Timings are CPU time measured around: NewFrame(), the workload's widget submission, EndFrame(), Render().
+//   'add_draw_lists' replays ImDrawData::AddDrawList() on the frame's final draw lists, as this is done inside Render().
+// - Allocation counts include every call going through ImGui::MemAlloc() during the measured frames.
+// - '--threads' sets the number of threads used by 'drawlist_threads' and 'table_sort_2m_keys_mt' (default: number of hardware threads).
+// - '--fonts' instead compares font atlas build times with single-threaded and multi-threaded glyph rasterization
+//   (ImFontAtlas::ParallelForFunc), and verifies that both produce identical texture pixels. It also times loading
+//   the same atlas from a cache file (ImFontAtlas::SaveCacheToFile()/LoadCacheFromFile()), and verifies that the cache is
+//   rejected when a font setting differs.
+//   Default font is built at multiple sizes, or use '--font-file' to load a font with Chinese glyph ranges.
+// - '--glyphs' fills a small atlas using ImFontAtlasFlags_DynamicGlyphs (default font file: misc/fonts/DroidSans.ttf),
+//   and verifies that glyphs used every frame are never evicted, and that new glyphs still load once the atlas is full.
+//   It also verifies that text rendered with io.ConfigTextLayoutCache matches uncached text while glyphs are evicted.
+// - '--idle' replays a scripted session of input events twice: rendering every tick at 60 Hz, then rendering only when
+//   io.WantRefresh is set, when io.RefreshTimeout elapsed or on new input events. Reports the number of frames saved,
+//   and verifies that the last rendered frame always matches the one rendered every tick.
+// - '--hover' verifies that FindHoveredWindowEx() finds the same windows with and without io.ConfigWindowsHoverGrid,
+//   on random windows and random positions, before/during/after submitting windows. It also times searches with
+//   thousands of child windows.
+// - '--idx32' verifies that draw lists converted to 32-bit indices (ImGuiBackendFlags_RendererHasIdx32) output the same
+//   triangles, textures, clipping rectangles and callbacks as 16-bit indices with ImDrawCmd::VtxOffset, by de-indexing
+//   draw data on the CPU. Large meshes and io.ConfigMergeDrawLists are toggled over frames, so reused draw lists go
+//   from 16-bit to 32-bit indices and back.
+// - '--opengl3' runs the OpenGL3 backend (imgui_impl_opengl3.cpp) on a mock GL function table, and verifies that uploading all
+//   draw lists at once (IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD) and using a persistently mapped ring buffer (IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE)
+//   draw the same triangles as the default path, with the expected number of buffer uploads.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImTextStrFromUtf8(), ImFontAtlasUpdateDynamicGlyphs()
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>     // intptr_t
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+#ifdef _MSC_VER
+#pragma warning (disable: 4996) // 'This function or variable may be unsafe': strcpy, strdup, sprintf, vsnprintf, sscanf, fopen
+#endif
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static double GetTimeInSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Allocation counters, wired with ImGui::SetAllocatorFunctions(). Atomic as some workloads allocate from worker threads.
+struct BenchAllocStats
+{
+    std::atomic<int>    AllocCount;
+    std::atomic<int>    FreeCount;
+    std::atomic<size_t> AllocBytes;
+};
+static BenchAllocStats g_AllocStats;
+
+static void* BenchMallocWrapper(size_t size, void* user_data)
+{
+    BenchAllocStats* stats = (BenchAllocStats*)user_data;
+    stats->AllocCount++;
+    stats->AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchFreeWrapper(void* ptr, void* user_data)
+{
+    BenchAllocStats* stats = (BenchAllocStats*)user_data;
+    if (ptr != NULL)
+        stats->FreeCount++;
+    free(ptr);
+}
+
+// Run jobs on 'thread_count' threads (including calling thread), each thread picking the next job index.
+static void BenchParallelFor(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data)
+{
+    const int thread_count = *(int*)user_data;
+    std::atomic<int> next_job(0);
+    auto run_jobs = [&]() { for (int job_i = next_job++; job_i < job_count; job_i = next_job++) job_func(job_data, job_i); };
+    std::thread threads[64];
+    const int workers_count = (thread_count < 64 ? thread_count : 64) - 1;
+    for (int n = 0; n < workers_count; n++)
+        threads[n] = std::thread(run_jobs);
+    run_jobs();
+    for (int n = 0; n < workers_count; n++)
+        threads[n].join();
+}
+
+// Simple deterministic random number generator so all runs submit the same data
+static unsigned int g_RandomState = 1;
+static float BenchRandomFloat()
+{
+    g_RandomState = g_RandomState * 1664525u + 1013904223u;
+    return (float)(g_RandomState >> 8) / 16777216.0f;
+}
+
+//-----------------------------------------------------------------------------
+// Workloads
+//-----------------------------------------------------------------------------
+
+// 10k rows table, submitted without a clipper (worst case for widget submission)
+static void Workload_Table10k()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1200, 1000));
+    ImGui::Begin("Table 10k");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table", 5, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Progress");
+        ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_NoSort);
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 10000; row++)
+        {
+            ImGui::PushID(row);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%05d", row);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Item name");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row * 0.125f);
+            ImGui::TableNextColumn();
+            ImGui::ProgressBar((row % 100) / 100.0f, ImVec2(-FLT_MIN, 0.0f));
+            ImGui::TableNextColumn();
+            ImGui::SmallButton("Edit");
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// 1M rows table with varying row heights, sorted and scrolled every frame, submitted with ImGuiTableVirtualizer
+static ImGuiTableVirtualizer g_TableVirtualizer;
+
+static float TableVirtual1M_GetRowHeight(void*, int item_n)
+{
+    return ImGui::GetTextLineHeight() * ((item_n % 5) == 0 ? 2 : 1) + ImGui::GetStyle().CellPadding.y * 2.0f;
+}
+
+static int TableVirtual1M_Compare(void*, const ImGuiTableSortSpecs* sort_specs, int a, int b)
+{
+    const int delta = (int)(((unsigned int)a * 2654435761u) % 1000) - (int)(((unsigned int)b * 2654435761u) % 1000);
+    return (sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending) ? delta : -delta;
+}
+
+static void Workload_TableVirtual1M()
+{
+    ImGuiTableVirtualizer& virt = g_TableVirtualizer;
+    virt.RowHeightFunc = TableVirtual1M_GetRowHeight;
+    virt.CompareFunc = TableVirtual1M_Compare;
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1200, 1000));
+    ImGui::Begin("Table 1M");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table", 3, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_NoSort);
+        ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_DefaultSort);
+        ImGui::TableSetupColumn("Description", ImGuiTableColumnFlags_NoSort);
+        ImGui::TableHeadersRow();
+        virt.Begin(1000000);
+        while (virt.Step())
+            for (int row_n = virt.DisplayStart; row_n < virt.DisplayEnd; row_n++)
+            {
+                const int item_n = virt.GetItemIndex(row_n);
+                virt.NextRow(row_n);
+                ImGui::TableNextColumn();
+                ImGui::Text("%07d", item_n);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", (int)(((unsigned int)item_n * 2654435761u) % 1000));
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted((item_n % 5) == 0 ? "Two lines\ndescription" : "Description");
+            }
+        ImGui::SetScrollY((float)(ImGui::GetFrameCount() * 7919 % 1000) * ImGui::GetScrollMaxY() / 1000.0f);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+static void Workload_TableVirtual1MShutdown()
+{
+    g_TableVirtualizer = ImGuiTableVirtualizer();
+}
+
+// 1M items list of 1 to 4 lines, scrolled every frame, heights measured by ImGuiListClipper when items are first displayed
+static ImGuiListClipperHeights g_ListMeasuredHeights;
+
+static void Workload_ListMeasured1M()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("List 1M");
+    g_ListMeasuredHeights.Resize(1000000, ImGui::GetTextLineHeightWithSpacing());
+    ImGuiListClipper clipper;
+    clipper.BeginWithHeights(&g_ListMeasuredHeights, true);
+    while (clipper.Step())
+        for (int item_n = clipper.DisplayStart; item_n < clipper.DisplayEnd; item_n++)
+        {
+            const int lines_count = 1 + (int)(((unsigned int)item_n * 2654435761u) >> 30);
+            ImGui::Text("Item %07d", item_n);
+            for (int line_n = 1; line_n < lines_count; line_n++)
+                ImGui::TextDisabled("  Detail line %d", line_n);
+        }
+    ImGui::SetScrollY((float)(ImGui::GetFrameCount() * 7919 % 1000) * ImGui::GetScrollMaxY() / 1000.0f);
+    ImGui::End();
+}
+
+static void Workload_ListMeasured1MShutdown()
+{
+    g_ListMeasuredHeights.Clear();
+}
+
+// Large tree: 3 levels of 24 nodes each (~14k nodes), all open
+static void Workload_TreeLarge()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("Tree");
+    for (int i = 0; i < 24; i++)
+    {
+        ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+        if (ImGui::TreeNode((void*)(intptr_t)i, "Node %d", i))
+        {
+            for (int j = 0; j < 24; j++)
+            {
+                ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+                if (ImGui::TreeNode((void*)(intptr_t)j, "Node %d.%d", i, j))
+                {
+                    for (int k = 0; k < 24; k++)
+                        ImGui::TreeNodeEx((void*)(intptr_t)k, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "Leaf %d.%d.%d", i, j, k);
+                    ImGui::TreePop();
+                }
+            }
+            ImGui::TreePop();
+        }
+    }
+    ImGui::End();
+}
+
+// Deep collapsible panels in a window scrolled to the middle, with or without BeginClipGroup() around each panel
+static void Workload_PanelsDeepEx(bool use_clip_groups)
+{
+    static float values[8] = { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f };
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::SetNextWindowScroll(ImVec2(0.0f, 20000.0f));
+    ImGui::Begin("Panels");
+    for (int i = 0; i < 400; i++)
+    {
+        ImGui::PushID(i);
+        if (!use_clip_groups || ImGui::BeginClipGroup("Panel"))
+        {
+            ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+            if (ImGui::TreeNode("Panel", "Panel %d", i))
+            {
+                for (int j = 0; j < 3; j++)
+                {
+                    ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+                    if (ImGui::TreeNode((void*)(intptr_t)j, "Section %d.%d", i, j))
+                    {
+                        ImGui::Text("Status: %d", i * 3 + j);
+                        ImGui::SliderFloat("Value", &values[j], 0.0f, 1.0f);
+                        ImGui::DragFloat4("Vector", &values[4]);
+                        ImGui::Button("Apply");
+                        ImGui::SameLine();
+                        ImGui::Button("Reset");
+                        ImGui::TreePop();
+                    }
+                }
+                ImGui::TreePop();
+            }
+            if (use_clip_groups)
+                ImGui::EndClipGroup();
+        }
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+static void Workload_PanelsDeep()           { Workload_PanelsDeepEx(false); }
+static void Workload_PanelsDeepClipGroups() { Workload_PanelsDeepEx(true); }
+
+// Heavy text: formatted, unformatted, colored and wrapped
+static void Workload_TextHeavyEx(bool use_text_layout_cache)
+{
+    ImGui::GetIO().ConfigTextLayoutCache = use_text_layout_cache;
+    static const char* paragraph =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+        "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.";
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1000, 1000));
+    ImGui::Begin("Text");
+    for (int i = 0; i < 1000; i++)
+    {
+        ImGui::Text("Line %d: value = %.3f, hex = 0x%08X", i, i * 0.5f, (unsigned int)i * 2654435761u);
+        ImGui::TextUnformatted("The quick brown fox jumps over the lazy dog.");
+        ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "Colored text %d", i);
+        if ((i % 10) == 0)
+            ImGui::TextWrapped("%s", paragraph);
+    }
+    ImGui::End();
+}
+
+static void Workload_TextHeavy()        { Workload_TextHeavyEx(false); }
+static void Workload_TextHeavyCached()  { Workload_TextHeavyEx(true); }
+
+// Thousands of small windows
+static void Workload_WindowsMany()
+{
+    for (int i = 0; i < 2000; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Window %d", i);
+        ImGui::SetNextWindowPos(ImVec2((float)((i % 40) * 48), (float)((i / 40) * 20)));
+        ImGui::SetNextWindowSize(ImVec2(160, 90));
+        ImGui::Begin(name);
+        ImGui::Text("Hello %d", i);
+        ImGui::Button("Button");
+        ImGui::End();
+    }
+}
+
+static void Workload_WindowsManyMerged()
+{
+    ImGui::GetIO().ConfigMergeDrawLists = true;
+    Workload_WindowsMany();
+}
+
+// Custom ImDrawList stress: shapes, long polylines and text
+// Content is split into 'slices_count' parts so it can also be filled by multiple threads.
+static void DrawListStressFill(ImDrawList* draw_list, ImFont* font, float font_size, int slice_n, int slices_count)
+{
+    static ImVec2 points[50000];
+    static bool points_init = false;
+    if (!points_init)
+    {
+        g_RandomState = 1;
+        for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+            points[n] = ImVec2(10.0f + n * 0.038f, 300.0f + 200.0f * sinf(n * 0.01f) + 20.0f * BenchRandomFloat());
+        points_init = true;
+    }
+    for (int n = 20000 * slice_n / slices_count; n < 20000 * (slice_n + 1) / slices_count; n++)
+    {
+        const ImVec2 p((float)(n % 200) * 9.0f, (float)(n / 200) * 9.0f);
+        draw_list->AddRectFilled(p, ImVec2(p.x + 8.0f, p.y + 8.0f), IM_COL32(n & 255, 128, 255 - (n & 255), 255));
+    }
+    for (int n = 5000 * slice_n / slices_count; n < 5000 * (slice_n + 1) / slices_count; n++)
+        draw_list->AddCircle(ImVec2((float)(n % 100) * 19.0f, (float)(n / 100) * 20.0f), 8.0f, IM_COL32_WHITE, 0, 1.5f);
+    if (slice_n == 0 % slices_count)
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 255, 0, 255), ImDrawFlags_None, 1.0f);
+    if (slice_n == 1 % slices_count)
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(0, 255, 255, 255), ImDrawFlags_None, 3.5f);
+    for (int n = 2000 * slice_n / slices_count; n < 2000 * (slice_n + 1) / slices_count; n++)
+        draw_list->AddText(font, font_size, ImVec2((float)(n % 20) * 96.0f, (float)(n / 20) * 10.0f), IM_COL32_WHITE, "Custom text");
+}
+
+static void Workload_DrawListStress()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("DrawList", NULL, ImGuiWindowFlags_NoDecoration);
+    DrawListStressFill(ImGui::GetWindowDrawList(), ImGui::GetFont(), ImGui::GetFontSize(), 0, 1);
+    ImGui::End();
+}
+
+// Same as 'drawlist_stress', pretending the renderer supports ImDrawList::IdxBuffer32: Render() converts the window draw list
+// to 32-bit indices, instead of outputting a new draw command every 64K vertices.
+static void Workload_DrawListStressIdx32()
+{
+    ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasIdx32;
+    Workload_DrawListStress();
+}
+
+// Same content as 'drawlist_stress', filled by worker threads into separate draw lists then appended to the window draw list.
+// The current context debug allocation counters (updated by ImGui::MemAlloc()) are not thread-safe. Draw lists are persistent
+// and filled with identical contents every frame, so only the first frame grows their buffers: we fill it on the main thread.
+// This is specific to this benchmark: applications should use a thread-local GImGui or IMGUI_DISABLE_DEBUG_TOOLS instead.
+static int                      g_ThreadCount = 1;
+static ImVector<ImDrawList*>    g_ThreadedDrawLists;
+
+struct DrawListStressJobs
+{
+    ImFont* Font;
+    float   FontSize;
+};
+
+static void DrawListStressJob(void* job_data, int job_n)
+{
+    DrawListStressJobs* jobs = (DrawListStressJobs*)job_data;
+    ImDrawList* draw_list = g_ThreadedDrawLists[job_n];
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTextureID(jobs->Font->ContainerAtlas->TexID);
+    draw_list->PushClipRectFullScreen();
+    DrawListStressFill(draw_list, jobs->Font, jobs->FontSize, job_n, g_ThreadedDrawLists.Size);
+}
+
+static void Workload_DrawListThreads()
+{
+    const bool first_frame = (g_ThreadedDrawLists.Size == 0);
+    if (first_frame)
+        for (int n = 0; n < 8; n++)
+            g_ThreadedDrawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+
+    DrawListStressJobs jobs = { ImGui::GetFont(), ImGui::GetFontSize() };
+    int thread_count = first_frame ? 1 : g_ThreadCount;
+    BenchParallelFor(DrawListStressJob, &jobs, g_ThreadedDrawLists.Size, &thread_count);
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("DrawList", NULL, ImGuiWindowFlags_NoDecoration);
+    for (ImDrawList* draw_list : g_ThreadedDrawLists)
+        ImGui::GetWindowDrawList()->AppendDrawList(draw_list);
+    ImGui::End();
+}
+
+static void Workload_DrawListThreadsShutdown()
+{
+    for (ImDrawList* draw_list : g_ThreadedDrawLists)
+        IM_DELETE(draw_list);
+    g_ThreadedDrawLists.clear();
+}
+
+// 2M rows table sorted every frame: with a compare function, with sort keys (single-threaded and multi-threaded),
+// and with sort keys where only the secondary sort spec changes (reusing the order of the primary sort spec).
+// Row height is fixed so timings are dominated by sorting.
+enum TableSort2MMode { TableSort2MMode_Compare, TableSort2MMode_Keys, TableSort2MMode_KeysMT, TableSort2MMode_Secondary };
+
+static int TableSort2M_GetValue(int item_n)
+{
+    return (int)(((unsigned int)item_n * 2654435761u) % 1000);
+}
+
+static double TableSort2M_GetSortKey(void*, const ImGuiTableColumnSortSpecs* sort_spec, int item_n)
+{
+    return (sort_spec->ColumnIndex == 0) ? item_n : TableSort2M_GetValue(item_n);
+}
+
+static int TableSort2M_Compare(void*, const ImGuiTableSortSpecs* sort_specs, int a, int b)
+{
+    for (int n = 0; n < sort_specs->SpecsCount; n++)
+    {
+        const ImGuiTableColumnSortSpecs* sort_spec = &sort_specs->Specs[n];
+        const int delta = (sort_spec->ColumnIndex == 0) ? (a - b) : (TableSort2M_GetValue(a) - TableSort2M_GetValue(b));
+        if (delta != 0)
+            return (sort_spec->SortDirection == ImGuiSortDirection_Ascending) ? delta : -delta;
+    }
+    return 0;
+}
+
+static void TableSort2M(TableSort2MMode mode)
+{
+    ImGuiTableVirtualizer& virt = g_TableVirtualizer;
+    virt.RowHeight = ImGui::GetTextLineHeightWithSpacing();
+    virt.CompareFunc = (mode == TableSort2MMode_Compare) ? TableSort2M_Compare : NULL;
+    virt.SortKeyFunc = (mode == TableSort2MMode_Compare) ? NULL : TableSort2M_GetSortKey;
+    virt.Sorter.ParallelForFunc = (mode == TableSort2MMode_KeysMT) ? BenchParallelFor : NULL;
+    virt.Sorter.ParallelForUserData = &g_ThreadCount;
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1200, 1000));
+    ImGui::Begin("Table Sort 2M");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table", 2, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_DefaultSort);
+        ImGui::TableHeadersRow();
+        if (mode == TableSort2MMode_Secondary)
+            ImGui::TableSetColumnSortDirection(0, (ImGui::GetFrameCount() & 1) ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending, true);
+        else
+            virt.Invalidate();
+        virt.Begin(2000000);
+        while (virt.Step())
+            for (int row_n = virt.DisplayStart; row_n < virt.DisplayEnd; row_n++)
+            {
+                const int item_n = virt.GetItemIndex(row_n);
+                virt.NextRow(row_n);
+                ImGui::TableNextColumn();
+                ImGui::Text("%07d", item_n);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", TableSort2M_GetValue(item_n));
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+static void Workload_TableSort2MCompare()   { TableSort2M(TableSort2MMode_Compare); }
+static void Workload_TableSort2MKeys()      { TableSort2M(TableSort2MMode_Keys); }
+static void Workload_TableSort2MKeysMT()    { TableSort2M(TableSort2MMode_KeysMT); }
+static void Workload_TableSort2MSecondary() { TableSort2M(TableSort2MMode_Secondary); }
+
+// ID hashing: string labels (with and without "###"), pointers and integers
+static void Workload_Ids()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::Begin("IDs");
+    ImGuiID acc = 0;
+    for (int n = 0; n < 20000; n++)
+    {
+        ImGui::PushID(n);
+        acc += ImGui::GetID("Button label");
+        acc += ImGui::GetID("Some longer label used by a widget##suffix");
+        acc += ImGui::GetID("Displayed label###StableIdentifier");
+        acc += ImGui::GetID((void*)(intptr_t)n);
+        ImGui::PopID();
+    }
+    ImGui::Text("%08X", acc);
+    ImGui::End();
+}
+
+// ImGuiStorage with many keys, used directly: rebuilt every frame by inserting 20k hashed keys (in random order, as
+// the open state of a large tree would be), then looked up 10 times. Sorted pairs (default) or hash table (SetUseHashTable()).
+static ImGuiStorage g_Storage;
+
+static void Workload_StorageEx(bool use_hash_table)
+{
+    const int keys_count = 20000;
+    g_Storage.Clear();
+    g_Storage.SetUseHashTable(use_hash_table);
+    for (int n = 0; n < keys_count; n++)
+        g_Storage.SetInt(ImHashData(&n, sizeof(n), 0), n);
+    for (int n = 0; n < keys_count; n++)
+        *g_Storage.GetVoidPtrRef(ImHashData(&n, sizeof(n), 1)) = (void*)(intptr_t)n;
+
+    int acc = 0;
+    for (int pass = 0; pass < 10; pass++)
+        for (int n = 0; n < keys_count; n++)
+            acc += g_Storage.GetInt(ImHashData(&n, sizeof(n), 0), -1);
+    IM_ASSERT(acc == 10 * (keys_count * (keys_count - 1) / 2));
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::Begin("Storage");
+    ImGui::Text("%d pairs, checksum %d", g_Storage.Data.Size, acc);
+    ImGui::End();
+}
+static void Workload_Storage()          { Workload_StorageEx(false); }
+static void Workload_StorageHashTable() { Workload_StorageEx(true); }
+
+static void Workload_StorageShutdown()
+{
+    g_Storage.Clear();
+}
+
+// Plot 1M values, appending 1000 new values per frame
+static void Workload_PlotLargeEx(bool use_minmax_cache)
+{
+    static ImVector<float> values;
+    static ImGuiPlotMinMaxCache values_cache;
+    if (values.Size == 0 || values.Size >= 1000000 + 1000 * 200)
+    {
+        values.resize(1000000);
+        for (int n = 0; n < values.Size; n++)
+            values[n] = sinf(n * 0.0001f) + ((n % 9973) == 0 ? 3.0f : 0.0f);
+        values_cache.Clear();
+    }
+    for (int n = 0; n < 1000; n++)
+        values.push_back(sinf(values.Size * 0.0001f));
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1280, 400));
+    ImGui::Begin("Plots");
+    if (use_minmax_cache)
+    {
+        values_cache.Update(values.Data, values.Size);
+        ImGui::PlotLines("Lines", &values_cache, 0, -1, NULL, FLT_MAX, FLT_MAX, ImVec2(-1.0f, 150.0f));
+        ImGui::PlotHistogram("Histogram", &values_cache, 0, -1, NULL, FLT_MAX, FLT_MAX, ImVec2(-1.0f, 150.0f));
+    }
+    else
+    {
+        ImGui::PlotLines("Lines", values.Data, values.Size, 0, NULL, FLT_MAX, FLT_MAX, ImVec2(-1.0f, 150.0f));
+        ImGui::PlotHistogram("Histogram", values.Data, values.Size, 0, NULL, FLT_MAX, FLT_MAX, ImVec2(-1.0f, 150.0f));
+    }
+    ImGui::End();
+}
+
+static void Workload_PlotLarge()        { Workload_PlotLargeEx(false); }
+static void Workload_PlotLargeMinMax()  { Workload_PlotLargeEx(true); }
+
+// Type one character per frame near the beginning of a 10 MB InputTextMultiline() buffer
+static int InputTextResizeCallback(ImGuiInputTextCallbackData* data)
+{
+    if (data->EventFlag == ImGuiInputTextFlags_CallbackResize)
+    {
+        ImVector<char>* buf = (ImVector<char>*)data->UserData;
+        buf->resize(data->BufSize);
+        data->Buf = buf->Data;
+    }
+    return 0;
+}
+
+static ImVector<char> g_InputTextLargeBuf;
+
+static void Workload_InputTextLarge()
+{
+    ImVector<char>& buf = g_InputTextLargeBuf;
+    if (buf.Size == 0)
+    {
+        ImGuiTextBuffer text;
+        for (int line = 0; text.size() < 10 * 1024 * 1024; line++)
+            text.appendf("%08d: The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet.\n", line);
+        buf.resize(text.size() + 1);
+        memcpy(buf.Data, text.c_str(), (size_t)text.size() + 1);
+    }
+    if (ImGui::GetFrameCount() > 1)
+        ImGui::GetIO().AddInputCharacter('a' + (ImGui::GetFrameCount() % 26));
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1280, 800));
+    ImGui::Begin("Editor");
+    ImGui::Text("%d bytes", buf.Size - 1);
+    if (ImGui::GetFrameCount() == 1)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", buf.Data, (size_t)buf.Size, ImVec2(-1.0f, -1.0f), ImGuiInputTextFlags_CallbackResize, InputTextResizeCallback, &buf);
+    ImGui::End();
+}
+
+static void Workload_InputTextLargeShutdown()
+{
+    g_InputTextLargeBuf.clear();
+}
+
+// Focused read-only InputTextMultiline() with 100k lines
+static ImGuiTextBuffer g_InputTextLinesBuf;
+
+static void Workload_InputTextLines()
+{
+    ImGuiTextBuffer& buf = g_InputTextLinesBuf;
+    if (buf.empty())
+        for (int line = 0; line < 100000; line++)
+            buf.appendf("%06d: The quick brown fox jumps over the lazy dog.\n", line);
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1280, 800));
+    ImGui::Begin("Viewer");
+    if (ImGui::GetFrameCount() == 1)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", (char*)buf.c_str(), (size_t)buf.size() + 1, ImVec2(-1.0f, -1.0f), ImGuiInputTextFlags_ReadOnly);
+    ImGui::End();
+}
+
+static void Workload_InputTextLinesShutdown()
+{
+    g_InputTextLinesBuf.clear();
+}
+
+// UTF-8 decoding throughput: ImTextCountCharsFromUtf8() + ImTextStrFromUtf8() over 1 MB of ASCII or mixed ASCII/CJK text
+static ImVector<char>    g_Utf8Corpus;
+static ImVector<ImWchar> g_Utf8CorpusW;
+
+static void Workload_Utf8DecodeEx(bool mixed)
+{
+    ImVector<char>& corpus = g_Utf8Corpus;
+    if (corpus.Size == 0)
+    {
+        ImGuiTextBuffer text;
+        for (int line = 0; text.size() < 1024 * 1024; line++)
+            if (mixed && (line % 2) == 1)
+                text.appendf("%06d: \xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe6\xa3\x95\xe8\x89\xb2\xe7\x8b\x90\xe7\x8b\xb8 (quick brown fox) \xe8\xb7\xb3\xe8\xbf\x87\xe4\xba\x86\xe6\x87\x92\xe7\x8b\x97\n", line);
+            else
+                text.appendf("%06d: The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet.\n", line);
+        corpus.resize(text.size());
+        memcpy(corpus.Data, text.c_str(), (size_t)text.size());
+        g_Utf8CorpusW.resize(corpus.Size + 1);
+    }
+    const int char_count = ImTextCountCharsFromUtf8(corpus.Data, corpus.Data + corpus.Size);
+    const int converted_count = ImTextStrFromUtf8(g_Utf8CorpusW.Data, g_Utf8CorpusW.Size, corpus.Data, corpus.Data + corpus.Size);
+    ImGui::Begin("UTF-8");
+    ImGui::Text("%d bytes, %d/%d characters", corpus.Size, char_count, converted_count);
+    ImGui::End();
+}
+
+static void Workload_Utf8Ascii()        { Workload_Utf8DecodeEx(false); }
+static void Workload_Utf8Mixed()        { Workload_Utf8DecodeEx(true); }
+
+static void Workload_Utf8DecodeShutdown()
+{
+    g_Utf8Corpus.clear();
+    g_Utf8CorpusW.clear();
+}
+
+// 500k lines log filtered every frame with ImGuiTextFilter, the filter text changing every frame (e.g. user typing):
+// calling PassFilter() on every line, or with ImGuiTextFilterIndex (filtering again all lines as the filter changed).
+static ImGuiTextBuffer      g_FilterLog;
+static ImVector<int>        g_FilterLogLineOffsets;
+static ImGuiTextFilterIndex g_FilterLogIndex;
+
+static void Workload_TextFilterEx(bool use_index)
+{
+    if (g_FilterLogLineOffsets.Size == 0)
+    {
+        static const char* levels[] = { "INFO ", "INFO ", "INFO ", "DEBUG", "DEBUG", "WARN " };
+        static const char* modules[] = { "render", "network", "audio", "physics", "input", "assets", "scripting" };
+        g_FilterLogLineOffsets.push_back(0);
+        for (int line = 0; line < 500000; line++)
+        {
+            const unsigned int r = (unsigned int)line * 2654435761u;
+            if ((r >> 8) % 1000 == 0)
+                g_FilterLog.appendf("[%06d] ERROR %s: failed to load resource #%u\n", line, modules[(r >> 4) % 7], r % 10000);
+            else
+                g_FilterLog.appendf("[%06d] %s %s: processed %u items in %u us\n", line, levels[(r >> 4) % 6], modules[(r >> 12) % 7], r % 1000, (r >> 16) % 5000);
+            g_FilterLogLineOffsets.push_back(g_FilterLog.size());
+        }
+        g_FilterLogLineOffsets.pop_back(); // Last line is empty
+    }
+
+    static const char* filters[] = { "error", "warn,-network", "physics", "failed to load" };
+    ImGuiTextFilter filter(filters[ImGui::GetFrameCount() % IM_ARRAYSIZE(filters)]);
+    const char* buf = g_FilterLog.begin();
+    const char* buf_end = g_FilterLog.end() - 1; // Skip last '\n'
+    const int lines_count = g_FilterLogLineOffsets.Size;
+    ImVector<int> passing_lines;
+    if (use_index)
+        g_FilterLogIndex.Update(&filter, buf, buf_end, g_FilterLogLineOffsets.Data, lines_count);
+    else
+        for (int line_n = 0; line_n < lines_count; line_n++)
+            if (filter.PassFilter(buf + g_FilterLogLineOffsets[line_n], (line_n + 1 < lines_count) ? buf + g_FilterLogLineOffsets[line_n + 1] - 1 : buf_end))
+                passing_lines.push_back(line_n);
+    const ImVector<int>& lines = use_index ? g_FilterLogIndex.PassingLines : passing_lines;
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1280, 800));
+    ImGui::Begin("Log");
+    ImGui::Text("%d lines passing filter \"%s\"", lines.Size, filter.InputBuf);
+    ImGuiListClipper clipper;
+    clipper.Begin(lines.Size);
+    while (clipper.Step())
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+        {
+            const int line_n = lines[i];
+            ImGui::TextUnformatted(buf + g_FilterLogLineOffsets[line_n], (line_n + 1 < lines_count) ? buf + g_FilterLogLineOffsets[line_n + 1] - 1 : buf_end);
+        }
+    ImGui::End();
+}
+
+static void Workload_TextFilter()       { Workload_TextFilterEx(false); }
+static void Workload_TextFilterIndex()  { Workload_TextFilterEx(true); }
+
+static void Workload_TextFilterShutdown()
+{
+    g_FilterLog.clear();
+    g_FilterLogLineOffsets.clear();
+    g_FilterLogIndex.Clear();
+}
+
+static void Workload_Demo()
+{
+    ImGui::ShowDemoWindow(NULL);
+}
+
+struct BenchWorkload
+{
+    const char* Name;
+    void        (*Func)();
+    void        (*Shutdown)();  // Optional: called before destroying the workload's context
+};
+
+static const BenchWorkload g_Workloads[] =
+{
+    { "table_10k",          Workload_Table10k, NULL },
+    { "table_virtual_1m",   Workload_TableVirtual1M, Workload_TableVirtual1MShutdown },
+    { "table_sort_2m_compare",   Workload_TableSort2MCompare, Workload_TableVirtual1MShutdown },
+    { "table_sort_2m_keys",      Workload_TableSort2MKeys, Workload_TableVirtual1MShutdown },
+    { "table_sort_2m_keys_mt",   Workload_TableSort2MKeysMT, Workload_TableVirtual1MShutdown },
+    { "table_sort_2m_secondary", Workload_TableSort2MSecondary, Workload_TableVirtual1MShutdown },
+    { "list_measured_1m",   Workload_ListMeasured1M, Workload_ListMeasured1MShutdown },
+    { "tree_large",         Workload_TreeLarge, NULL },
+    { "panels_deep",        Workload_PanelsDeep, NULL },
+    { "panels_deep_clip_groups", Workload_PanelsDeepClipGroups, NULL },
+    { "text_heavy",         Workload_TextHeavy, NULL },
+    { "text_heavy_cached",  Workload_TextHeavyCached, NULL },
+    { "windows_many",       Workload_WindowsMany, NULL },
+    { "windows_many_merged", Workload_WindowsManyMerged, NULL },
+    { "drawlist_stress",    Workload_DrawListStress, NULL },
+    { "drawlist_stress_idx32", Workload_DrawListStressIdx32, NULL },
+    { "drawlist_threads",   Workload_DrawListThreads, Workload_DrawListThreadsShutdown },
+    { "ids",                Workload_Ids, NULL },
+    { "storage_20k",        Workload_Storage, Workload_StorageShutdown },
+    { "storage_20k_hash",   Workload_StorageHashTable, Workload_StorageShutdown },
+    { "plot_1m",            Workload_PlotLarge, NULL },
+    { "plot_1m_minmax",     Workload_PlotLargeMinMax, NULL },
+    { "input_text_10mb",    Workload_InputTextLarge, Workload_InputTextLargeShutdown },
+    { "input_text_lines",   Workload_InputTextLines, Workload_InputTextLinesShutdown },
+    { "utf8_ascii",         Workload_Utf8Ascii, Workload_Utf8DecodeShutdown },
+    { "utf8_mixed",         Workload_Utf8Mixed, Workload_Utf8DecodeShutdown },
+    { "text_filter_500k",   Workload_TextFilter, Workload_TextFilterShutdown },
+    { "text_filter_500k_index", Workload_TextFilterIndex, Workload_TextFilterShutdown },
+    { "demo",               Workload_Demo, NULL },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+enum BenchPhase
+{
+    BenchPhase_NewFrame,
+    BenchPhase_Submit,
+    BenchPhase_EndFrame,
+    BenchPhase_Render,
+    BenchPhase_AddDrawLists,
+    BenchPhase_COUNT
+};
+static const char* g_PhaseNames[BenchPhase_COUNT] = { "new_frame", "submit", "end_frame", "render", "add_draw_lists" };
+
+struct BenchResult
+{
+    const char* Name;
+    int         Frames;
+    double      PhaseTotal[BenchPhase_COUNT];   // Seconds, summed over measured frames
+    double      PhaseMin[BenchPhase_COUNT];     // Seconds, best frame
+    double      FrameMin;
+    double      FrameTotal;
+    int         DrawLists;                      // Last frame
+    int         DrawCmds;                       // Last frame
+    int         VtxCount;                       // Last frame
+    int         IdxCount;                       // Last frame
+    int         AllocCount;                     // Summed over measured frames
+    size_t      AllocBytes;                     // Summed over measured frames
+};
+
+static void RunWorkload(const BenchWorkload& workload, ImFontAtlas* font_atlas, int warmup_frames, int frames, BenchResult* out)
+{
+    ImGui::CreateContext(font_atlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Allow large meshes with 16-bit indices
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+
+    memset(out, 0, sizeof(*out));
+    out->Name = workload.Name;
+    out->Frames = frames;
+    out->FrameMin = 1e30;
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        out->PhaseMin[phase] = 1e30;
+
+    ImDrawData scratch_draw_data;
+    for (int frame = 0; frame < warmup_frames + frames; frame++)
+    {
+        const bool measure = (frame >= warmup_frames);
+        const int alloc_count_begin = g_AllocStats.AllocCount;
+        const size_t alloc_bytes_begin = g_AllocStats.AllocBytes;
+        double t[BenchPhase_COUNT + 1];
+        t[0] = GetTimeInSeconds();
+        ImGui::NewFrame();
+        t[1] = GetTimeInSeconds();
+        workload.Func();
+        t[2] = GetTimeInSeconds();
+        ImGui::EndFrame();
+        t[3] = GetTimeInSeconds();
+        ImGui::Render();
+        t[4] = GetTimeInSeconds();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        scratch_draw_data.Clear();
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            scratch_draw_data.AddDrawList(draw_list);
+        t[5] = GetTimeInSeconds();
+        if (!measure)
+            continue;
+
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+        {
+            const double dt = t[phase + 1] - t[phase];
+            out->PhaseTotal[phase] += dt;
+            if (dt < out->PhaseMin[phase])
+                out->PhaseMin[phase] = dt;
+        }
+        const double frame_dt = t[BenchPhase_COUNT] - t[0];
+        out->FrameTotal += frame_dt;
+        if (frame_dt < out->FrameMin)
+            out->FrameMin = frame_dt;
+        out->AllocCount += g_AllocStats.AllocCount - alloc_count_begin;
+        out->AllocBytes += g_AllocStats.AllocBytes - alloc_bytes_begin;
+        out->DrawLists = draw_data->CmdListsCount;
+        out->DrawCmds = 0;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            out->DrawCmds += draw_list->CmdBuffer.Size;
+        out->VtxCount = draw_data->TotalVtxCount;
+        out->IdxCount = draw_data->TotalIdxCount;
+    }
+    scratch_draw_data.Clear();
+    if (workload.Shutdown)
+        workload.Shutdown();
+    ImGui::DestroyContext();
+}
+
+static void PrintResult(const BenchResult& r, const char* format, bool first)
+{
+    const double ms = 1000.0;
+    const double inv_frames = (r.Frames > 0) ? 1.0 / r.Frames : 0.0;
+    if (strcmp(format, "json") == 0)
+    {
+        printf("%s{\"workload\":\"%s\",\"frames\":%d,\"frame_ms\":{\"mean\":%.4f,\"min\":%.4f}", first ? "[\n  " : ",\n  ", r.Name, r.Frames, r.FrameTotal * inv_frames * ms, r.FrameMin * ms);
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(",\"%s_ms\":{\"mean\":%.4f,\"min\":%.4f}", g_PhaseNames[phase], r.PhaseTotal[phase] * inv_frames * ms, r.PhaseMin[phase] * ms);
+        printf(",\"draw_lists\":%d,\"draw_cmds\":%d,\"vtx_count\":%d,\"idx_count\":%d,\"allocs_per_frame\":%.2f,\"alloc_bytes_per_frame\":%.1f}",
+            r.DrawLists, r.DrawCmds, r.VtxCount, r.IdxCount, r.AllocCount * inv_frames, (double)r.AllocBytes * inv_frames);
+    }
+    else if (strcmp(format, "csv") == 0)
+    {
+        if (first)
+        {
+            printf("workload,frames,frame_mean_ms,frame_min_ms");
+            for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+                printf(",%s_mean_ms,%s_min_ms", g_PhaseNames[phase], g_PhaseNames[phase]);
+            printf(",draw_lists,draw_cmds,vtx_count,idx_count,allocs_per_frame,alloc_bytes_per_frame\n");
+        }
+        printf("%s,%d,%.4f,%.4f", r.Name, r.Frames, r.FrameTotal * inv_frames * ms, r.FrameMin * ms);
+        for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+            printf(",%.4f,%.4f", r.PhaseTotal[phase] * inv_frames * ms, r.PhaseMin[phase] * ms);
+        printf(",%d,%d,%d,%d,%.2f,%.1f\n", r.DrawLists, r.DrawCmds, r.VtxCount, r.IdxCount, r.AllocCount * inv_frames, (double)r.AllocBytes * inv_frames);
+    }
+    else
+    {
+        if (first)
+            printf("%-16s %9s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n", "workload", "frame_ms", "newframe", "submit", "endframe", "render", "add_dl", "cmds", "vtx", "idx", "allocs");
+        printf("%-16s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9d %9d %9d %9.1f\n", r.Name, r.FrameTotal * inv_frames * ms,
+            r.PhaseTotal[BenchPhase_NewFrame] * inv_frames * ms, r.PhaseTotal[BenchPhase_Submit] * inv_frames * ms, r.PhaseTotal[BenchPhase_EndFrame] * inv_frames * ms,
+            r.PhaseTotal[BenchPhase_Render] * inv_frames * ms, r.PhaseTotal[BenchPhase_AddDrawLists] * inv_frames * ms,
+            r.DrawCmds, r.VtxCount, r.IdxCount, r.AllocCount * inv_frames);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Font atlas build
+//-----------------------------------------------------------------------------
+
+static void AddBenchFonts(ImFontAtlas* atlas, const char* font_file)
+{
+    static const float sizes[] = { 13.0f, 16.0f, 20.0f, 24.0f, 32.0f, 48.0f };
+    for (float size : sizes)
+    {
+        ImFontConfig font_cfg;
+        if (font_file)
+            atlas->AddFontFromFileTTF(font_file, size, &font_cfg, atlas->GetGlyphRangesChineseFull());
+        else
+        {
+            font_cfg.OversampleH = 3; // Default font is setup without oversampling, make it heavier
+            font_cfg.SizePixels = size * 2.0f;
+            atlas->AddFontDefault(&font_cfg);
+        }
+    }
+}
+
+static int RunFontBuild(int thread_count, const char* font_file)
+{
+    const int repeat_count = 5;
+    double build_time[2] = { 1e30, 1e30 };
+    ImFontAtlas* atlas[2] = {};
+    for (int mode = 0; mode < 2; mode++)
+        for (int repeat = 0; repeat < repeat_count; repeat++)
+        {
+            if (atlas[mode])
+                IM_DELETE(atlas[mode]);
+            atlas[mode] = IM_NEW(ImFontAtlas)();
+            atlas[mode]->TexDesiredWidth = 4096;
+            AddBenchFonts(atlas[mode], font_file);
+            if (mode == 1)
+            {
+                atlas[mode]->ParallelForFunc = BenchParallelFor;
+                atlas[mode]->ParallelForUserData = &thread_count;
+            }
+            const double t0 = GetTimeInSeconds();
+            atlas[mode]->Build();
+            const double dt = GetTimeInSeconds() - t0;
+            if (dt < build_time[mode])
+                build_time[mode] = dt;
+        }
+
+    int glyphs_count = 0;
+    for (ImFont* font : atlas[0]->Fonts)
+        glyphs_count += font->Glyphs.Size;
+    const bool identical = atlas[0]->TexWidth == atlas[1]->TexWidth && atlas[0]->TexHeight == atlas[1]->TexHeight
+        && memcmp(atlas[0]->TexPixelsAlpha8, atlas[1]->TexPixelsAlpha8, (size_t)atlas[0]->TexWidth * atlas[0]->TexHeight) == 0;
+    printf("font_atlas: %d fonts, %d glyphs, %dx%d texture\n", atlas[0]->Fonts.Size, glyphs_count, atlas[0]->TexWidth, atlas[0]->TexHeight);
+    printf("  1 thread:   %9.3f ms\n", build_time[0] * 1000.0);
+    printf("  %d threads: %9.3f ms (x%.2f)\n", thread_count, build_time[1] * 1000.0, build_time[0] / build_time[1]);
+    printf("  pixels identical: %s\n", identical ? "yes" : "NO");
+
+    // Load from cache file (ImFontAtlas::LoadCacheFromFile)
+    const char* cache_filename = "example_null_bench_fonts.cache";
+    bool cache_ok = atlas[0]->SaveCacheToFile(cache_filename);
+    double cache_time = 1e30;
+    for (int repeat = 0; repeat < repeat_count && cache_ok; repeat++)
+    {
+        ImFontAtlas* cached_atlas = IM_NEW(ImFontAtlas)();
+        cached_atlas->TexDesiredWidth = 4096;
+        AddBenchFonts(cached_atlas, font_file);
+        const double t0 = GetTimeInSeconds();
+        cache_ok = cached_atlas->LoadCacheFromFile(cache_filename);
+        const double dt = GetTimeInSeconds() - t0;
+        if (dt < cache_time)
+            cache_time = dt;
+        cache_ok = cache_ok && cached_atlas->TexHeight == atlas[0]->TexHeight && memcmp(cached_atlas->TexPixelsAlpha8, atlas[0]->TexPixelsAlpha8, (size_t)atlas[0]->TexWidth * atlas[0]->TexHeight) == 0;
+        for (int font_n = 0; font_n < cached_atlas->Fonts.Size && cache_ok; font_n++)
+        {
+            const ImVector<ImFontGlyph>& glyphs_a = cached_atlas->Fonts[font_n]->Glyphs;
+            const ImVector<ImFontGlyph>& glyphs_b = atlas[0]->Fonts[font_n]->Glyphs;
+            cache_ok = glyphs_a.Size == glyphs_b.Size && memcmp(glyphs_a.Data, glyphs_b.Data, (size_t)glyphs_a.size_in_bytes()) == 0;
+        }
+        IM_DELETE(cached_atlas);
+    }
+
+    // Cache must be rejected when any font setting differs
+    if (cache_ok)
+    {
+        ImFontAtlas* other_atlas = IM_NEW(ImFontAtlas)();
+        other_atlas->TexDesiredWidth = 4096;
+        AddBenchFonts(other_atlas, font_file);
+        other_atlas->ConfigData.back().OversampleH++;
+        if (other_atlas->LoadCacheFromFile(cache_filename))
+        {
+            printf("  cache loaded with different settings!\n");
+            cache_ok = false;
+        }
+        IM_DELETE(other_atlas);
+    }
+    remove(cache_filename);
+    if (cache_ok)
+        printf("  cache load: %9.3f ms (x%.2f)\n", cache_time * 1000.0, build_time[0] / cache_time);
+    else
+        printf("  cache load: FAILED\n");
+
+    IM_DELETE(atlas[0]);
+    IM_DELETE(atlas[1]);
+    return (identical && cache_ok) ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs)
+//-----------------------------------------------------------------------------
+
+// Create atlas with two sizes of a font, rasterizing only ASCII in Build()
+static ImFontAtlas* DynamicGlyphsTestCreateAtlas(const char* font_file)
+{
+    static const ImWchar ranges[] = { 0x0020, 0x007E, 0 };
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    atlas->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+    atlas->TexDesiredWidth = 512;
+    if (atlas->AddFontFromFileTTF(font_file, 16.0f, NULL, ranges) == NULL || atlas->AddFontFromFileTTF(font_file, 32.0f, NULL, ranges) == NULL)
+    {
+        IM_DELETE(atlas);
+        return NULL;
+    }
+    atlas->Build();
+    return atlas;
+}
+
+// Use glyphs of all fonts in [c_begin, c_end) for a frame. Return number of glyphs missing.
+static int DynamicGlyphsTestUse(ImFontAtlas* atlas, ImWchar c_begin, ImWchar c_end)
+{
+    int missing_count = 0;
+    for (ImFont* font : atlas->Fonts)
+        for (ImWchar c = c_begin; c < c_end; c++)
+            if (font->FindGlyph(c) == font->FallbackGlyph && c != font->FallbackChar)
+                missing_count++;
+    return missing_count;
+}
+
+// Render text using glyphs loaded and evicted over frames, with and without io.ConfigTextLayoutCache.
+// Return true if both contexts output the same vertices. Cached glyph positions are summed in a different order: allow rounding errors.
+static bool DynamicGlyphsTestTextLayoutCache(const char* font_file, ImWchar c_begin, ImWchar c_end)
+{
+    ImGuiContext* contexts[2];
+    for (int ctx_n = 0; ctx_n < 2; ctx_n++)
+    {
+        contexts[ctx_n] = ImGui::CreateContext(DynamicGlyphsTestCreateAtlas(font_file));
+        ImGui::SetCurrentContext(contexts[ctx_n]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1280, 720);
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;
+        io.ConfigTextLayoutCache = (ctx_n == 1);
+    }
+
+    bool valid = true;
+    ImVector<ImDrawVert> out_vtx[2];
+    for (ImWchar c = c_begin; c < c_end && valid; c += 16)
+    {
+        // Same hot glyphs every frame, 16 new glyphs every 2 frames
+        ImWchar text_w[20] = { 0x00C0, 0x00C9, 0x00D6, ' ' };
+        for (int n = 0; n < 16; n++)
+            text_w[4 + n] = (ImWchar)(c + n);
+        char text[128];
+        ImTextStrToUtf8(text, IM_ARRAYSIZE(text), text_w, text_w + IM_ARRAYSIZE(text_w));
+        for (int frame = 0; frame < 2; frame++)
+        {
+            for (int ctx_n = 0; ctx_n < 2; ctx_n++)
+            {
+                ImGui::SetCurrentContext(contexts[ctx_n]);
+                ImGuiIO& io = ImGui::GetIO();
+                io.DeltaTime = 1.0f / 60.0f;
+                ImGui::NewFrame();
+                ImGui::SetNextWindowPos(ImVec2(0, 0));
+                ImGui::SetNextWindowSize(ImVec2(400, 400));
+                ImGui::Begin("Text");
+                for (ImFont* font : io.Fonts->Fonts)
+                {
+                    ImGui::PushFont(font);
+                    ImGui::TextUnformatted(text);
+                    ImGui::Button(text);
+                    ImGui::TextWrapped("%s %s", text, text);
+                    ImGui::PopFont();
+                }
+                ImGui::End();
+                ImGui::Render();
+                io.Fonts->ClearTexDirty();
+                out_vtx[ctx_n].resize(0);
+                for (ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+                    for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+                        out_vtx[ctx_n].push_back(vtx);
+            }
+            valid &= (out_vtx[0].Size == out_vtx[1].Size);
+            for (int n = 0; n < out_vtx[0].Size && valid; n++)
+            {
+                const ImDrawVert& a = out_vtx[0][n];
+                const ImDrawVert& b = out_vtx[1][n];
+                valid &= ImFabs(a.pos.x - b.pos.x) < 0.001f && ImFabs(a.pos.y - b.pos.y) < 0.001f && a.uv.x == b.uv.x && a.uv.y == b.uv.y && a.col == b.col;
+            }
+        }
+    }
+    for (ImGuiContext* ctx : contexts)
+    {
+        ImGui::SetCurrentContext(ctx);
+        ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+        ImGui::DestroyContext(ctx);
+        IM_DELETE(atlas);
+    }
+    return valid;
+}
+
+// Fill atlas with glyphs used once, while using a set of 'hot' glyphs every frame. Verify that:
+// - hot glyphs are never evicted.
+// - once the atlas is full, new glyphs still load by evicting least recently used glyphs.
+// - text rendered with io.ConfigTextLayoutCache is not affected by glyphs being loaded and evicted.
+static int RunDynamicGlyphsTest(const char* font_file)
+{
+    if (font_file == NULL)
+        font_file = "../../misc/fonts/DroidSans.ttf";
+    const ImWchar hot_begin = 0x00C0, hot_end = 0x0100;     // Latin-1 letters
+    const ImWchar new_begin = 0x0430, new_end = 0x0450;     // Cyrillic lowercase: not used while filling
+    const ImWchar fill_begin = 0x0100, fill_end = 0x3000;
+
+    // Reference: number of glyphs available in font data, loaded in an empty atlas
+    ImFontAtlas* atlas = DynamicGlyphsTestCreateAtlas(font_file);
+    if (atlas == NULL)
+    {
+        fprintf(stderr, "Failed to load '%s'. Use --font-file.\n", font_file);
+        return 1;
+    }
+    DynamicGlyphsTestUse(atlas, hot_begin, hot_end);
+    DynamicGlyphsTestUse(atlas, new_begin, new_end);
+    ImFontAtlasUpdateDynamicGlyphs(atlas);
+    const int hot_missing_ref = DynamicGlyphsTestUse(atlas, hot_begin, hot_end);
+    const int new_missing_ref = DynamicGlyphsTestUse(atlas, new_begin, new_end);
+    IM_DELETE(atlas);
+
+    atlas = DynamicGlyphsTestCreateAtlas(font_file);
+    DynamicGlyphsTestUse(atlas, hot_begin, hot_end);
+    ImFontAtlasUpdateDynamicGlyphs(atlas);
+    int loaded_count = 0;
+    for (ImFont* font : atlas->Fonts)
+        loaded_count += font->Glyphs.Size;
+
+    // Fill: request 64 glyphs per frame
+    int hot_evicted_frames = 0;
+    const double t0 = GetTimeInSeconds();
+    for (ImWchar c = fill_begin; c < fill_end; c += 64)
+    {
+        if (DynamicGlyphsTestUse(atlas, hot_begin, hot_end) != hot_missing_ref)
+            hot_evicted_frames++;
+        for (ImWchar c2 = c; c2 < c + 64; c2++)
+            if (c2 < new_begin || c2 >= new_end)
+                DynamicGlyphsTestUse(atlas, c2, c2 + 1);
+        ImFontAtlasUpdateDynamicGlyphs(atlas);
+        for (ImFont* font : atlas->Fonts)
+            for (ImWchar c2 = c; c2 < c + 64; c2++)
+                if (font->FindGlyphNoFallback(c2) != NULL)
+                    loaded_count++;
+    }
+    const double dt = GetTimeInSeconds() - t0;
+    int resident_count = 0;
+    for (ImFont* font : atlas->Fonts)
+        resident_count += font->Glyphs.Size;
+
+    // New glyphs after filling: requested on first frame, available on the frame after their first use
+    DynamicGlyphsTestUse(atlas, hot_begin, hot_end);
+    DynamicGlyphsTestUse(atlas, new_begin, new_end);
+    ImFontAtlasUpdateDynamicGlyphs(atlas);
+    if (DynamicGlyphsTestUse(atlas, hot_begin, hot_end) != hot_missing_ref)
+        hot_evicted_frames++;
+    const int new_missing = DynamicGlyphsTestUse(atlas, new_begin, new_end);
+    const int new_count = (int)(new_end - new_begin) * atlas->Fonts.Size;
+    IM_DELETE(atlas);
+
+    const bool text_layout_cache_valid = DynamicGlyphsTestTextLayoutCache(font_file, fill_begin, fill_end);
+
+    const bool atlas_full = loaded_count > resident_count;
+    printf("dynamic_glyphs: %d glyphs loaded while filling in %.3f ms, %d resident (atlas %s)\n", loaded_count, dt * 1000.0, resident_count, atlas_full ? "full" : "NOT full");
+    printf("  hot glyphs evicted: %s\n", hot_evicted_frames ? "YES" : "no");
+    printf("  new glyphs loaded after filling: %d/%d\n", new_count - new_missing, new_count - new_missing_ref);
+    printf("  text layout cache output identical: %s\n", text_layout_cache_valid ? "yes" : "NO");
+    return (atlas_full && hot_evicted_frames == 0 && new_missing == new_missing_ref && text_layout_cache_valid) ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Idle session (io.WantRefresh, io.RefreshTimeout)
+//-----------------------------------------------------------------------------
+
+// Replay the same scripted session of mouse/keyboard events at 60 Hz:
+// - rendering every tick,
+// - rendering only when there are new events, when io.WantRefresh is set or when io.RefreshTimeout elapsed.
+// A frame which is not rendered is valid only if the last rendered frame is identical to the one rendered every tick.
+enum IdleItem { IdleItem_Button, IdleItem_Input, IdleItem_Checkbox, IdleItem_Slider, IdleItem_OpenModal, IdleItem_CloseModal, IdleItem_COUNT };
+static ImVec2 g_IdleItemPos[IdleItem_COUNT];
+static char   g_IdleText[64];
+static bool   g_IdleCheck;
+static float  g_IdleValue;
+
+static void IdleSessionRecordItem(IdleItem item)
+{
+    const ImVec2 min = ImGui::GetItemRectMin(), max = ImGui::GetItemRectMax();
+    g_IdleItemPos[item] = ImVec2((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f);
+}
+
+static void IdleSessionFrame()
+{
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(400, 300));
+    ImGui::Begin("Idle");
+    ImGui::Button("Hover me");
+    IdleSessionRecordItem(IdleItem_Button);
+    ImGui::SetItemTooltip("Tooltip");
+    ImGui::InputText("Text", g_IdleText, IM_ARRAYSIZE(g_IdleText));
+    IdleSessionRecordItem(IdleItem_Input);
+    ImGui::Checkbox("Check", &g_IdleCheck);
+    IdleSessionRecordItem(IdleItem_Checkbox);
+    ImGui::SliderFloat("Value", &g_IdleValue, 0.0f, 1.0f);
+    IdleSessionRecordItem(IdleItem_Slider);
+    if (ImGui::Button("Open modal"))
+        ImGui::OpenPopup("Modal");
+    IdleSessionRecordItem(IdleItem_OpenModal);
+    if (ImGui::BeginPopupModal("Modal", NULL, ImGuiWindowFlags_AlwaysAutoResize))
+    {
+        ImGui::Text("Modal contents");
+        if (ImGui::Button("Close"))
+            ImGui::CloseCurrentPopup();
+        IdleSessionRecordItem(IdleItem_CloseModal);
+        ImGui::EndPopup();
+    }
+    ImGui::End();
+}
+
+static void IdleSessionQueueEvents(ImGuiIO& io, int tick)
+{
+    struct { int Tick; IdleItem Item; float OffsetX; } mouse_moves[] = { { 60, IdleItem_Button, 0 }, { 180, IdleItem_Input, 0 }, { 400, IdleItem_Checkbox, 0 }, { 480, IdleItem_Slider, -40 }, { 600, IdleItem_OpenModal, 0 }, { 690, IdleItem_CloseModal, 0 } };
+    for (const auto& move : mouse_moves)
+        if (tick == move.Tick)
+            io.AddMousePosEvent(g_IdleItemPos[move.Item].x + move.OffsetX, g_IdleItemPos[move.Item].y);
+    if (tick == 185 || tick == 420 || tick == 485 || tick == 620 || tick == 720)
+        io.AddMouseButtonEvent(0, true);
+    if (tick == 187 || tick == 422 || tick == 520 || tick == 622 || tick == 722)
+        io.AddMouseButtonEvent(0, false);
+    if (tick > 485 && tick <= 505)  // Drag slider
+        io.AddMousePosEvent(g_IdleItemPos[IdleItem_Slider].x - 40.0f + (float)(tick - 485) * 4.0f, g_IdleItemPos[IdleItem_Slider].y);
+    if (tick >= 200 && tick < 260 && (tick % 5) == 0) // Type text
+        io.AddInputCharacter('a' + (tick - 200) / 5);
+    if (tick == 300 || tick == 340) // Hold left arrow (key repeat)
+        io.AddKeyEvent(ImGuiKey_LeftArrow, tick == 300);
+    if (tick == 800)
+        io.AddMousePosEvent(600.0f, 500.0f);
+}
+
+static ImU32 IdleSessionHashDrawData(ImDrawData* draw_data)
+{
+    ImU32 hash = 0;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer32.Data, (size_t)draw_list->IdxBuffer32.size_in_bytes(), hash);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            hash = ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+    }
+    return hash;
+}
+
+static int RunIdleSession()
+{
+    const int ticks_count = 60 * 20;
+    const float tick_duration = 1.0f / 60.0f;
+    ImFontAtlas* font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImVector<ImU32> hashes[2];
+    int frames_count[2] = { 0, 0 };
+    float max_sleep = 0.0f;
+    int mismatches = 0;
+    for (int mode = 0; mode < 2; mode++)
+    {
+        const bool idle_mode = (mode == 1);
+        ImGui::CreateContext(font_atlas);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1280, 720);
+        g_IdleText[0] = 0;
+        g_IdleCheck = false;
+        g_IdleValue = 0.5f;
+        int last_frame_tick = -1;
+        ImU32 displayed_hash = 0;
+        for (int tick = 0; tick < ticks_count; tick++)
+        {
+            const int prev_queue_size = ImGui::GetCurrentContext()->InputEventsQueue.Size;
+            IdleSessionQueueEvents(io, tick);
+            const bool has_events = ImGui::GetCurrentContext()->InputEventsQueue.Size != prev_queue_size;
+            const float elapsed = (float)(tick - last_frame_tick) * tick_duration;
+            if (!idle_mode || has_events || io.WantRefresh || elapsed >= io.RefreshTimeout)
+            {
+                io.DeltaTime = (last_frame_tick >= 0) ? elapsed : tick_duration;
+                ImGui::NewFrame();
+                IdleSessionFrame();
+                ImGui::Render();
+                displayed_hash = IdleSessionHashDrawData(ImGui::GetDrawData());
+                last_frame_tick = tick;
+                frames_count[mode]++;
+            }
+            else
+            {
+                max_sleep = ImMax(max_sleep, elapsed);
+            }
+            hashes[mode].push_back(displayed_hash);
+            if (idle_mode && hashes[1][tick] != hashes[0][tick])
+            {
+                if (mismatches < 10)
+                    printf("  mismatch at tick %d (last frame at tick %d)\n", tick, last_frame_tick);
+                mismatches++;
+            }
+        }
+        ImGui::DestroyContext();
+    }
+    IM_DELETE(font_atlas);
+
+    printf("idle_session: %d ticks (%.1f s at 60 Hz)\n", ticks_count, ticks_count * tick_duration);
+    printf("  rendering every tick:  %5d frames\n", frames_count[0]);
+    printf("  rendering when needed: %5d frames (%.1f%% saved), longest idle %.2f s\n", frames_count[1], 100.0f * (1.0f - (float)frames_count[1] / (float)frames_count[0]), max_sleep);
+    printf("  displayed frames identical: %s\n", (mismatches == 0) ? "yes" : "NO");
+    return (mismatches == 0) ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Hovered window search (io.ConfigWindowsHoverGrid)
+//-----------------------------------------------------------------------------
+
+// Submit random windows: overlapping windows with various flags and z-order, child windows extending outside of
+// their parent, hit-test holes, tooltips. Layout changes every few frames so the grid gets reused across frames,
+// and some windows are hidden for a few frames, change flags, are skipped, focused or resized in between.
+static float HoverTestLayoutRandom(unsigned int* seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / 16777216.0f;
+}
+
+static void HoverTestSubmitWindows(int window_begin, int window_end, int frame, float change_rate)
+{
+    for (int i = window_begin; i < window_end; i++)
+    {
+        if (BenchRandomFloat() < change_rate || ((i % 7) == 0 && ((frame / 2 + i) % 4) == 0))
+            continue;
+        unsigned int seed = (unsigned int)(i * 7919 + (frame / 16) * 104729);
+        char name[32];
+        snprintf(name, sizeof(name), "Window %d", i);
+        ImGuiWindowFlags flags = ((i % 7) == 0) ? ImGuiWindowFlags_NoFocusOnAppearing : 0;
+        const float flags_r = HoverTestLayoutRandom(&seed);
+        if (flags_r < 0.1f)
+            flags |= ImGuiWindowFlags_NoResize;
+        else if (flags_r < 0.2f)
+            flags |= ImGuiWindowFlags_AlwaysAutoResize;
+        else if (flags_r < 0.3f)
+            flags |= ImGuiWindowFlags_NoMouseInputs;
+        else if (flags_r < 0.35f)
+            flags |= ImGuiWindowFlags_NoBringToFrontOnFocus;
+        if ((i % 11) == 0 && (((frame + 1) / 5) & 1))
+            flags |= ImGuiWindowFlags_NoMouseInputs;
+        ImGui::SetNextWindowPos(ImVec2(HoverTestLayoutRandom(&seed) * 1400.0f - 100.0f, HoverTestLayoutRandom(&seed) * 800.0f - 50.0f));
+        const ImVec2 size(20.0f + HoverTestLayoutRandom(&seed) * 300.0f, 20.0f + HoverTestLayoutRandom(&seed) * 200.0f);
+        if (!(flags & ImGuiWindowFlags_AlwaysAutoResize))
+            ImGui::SetNextWindowSize((BenchRandomFloat() < change_rate) ? ImVec2(size.x + 10.0f, size.y) : size);
+        if (BenchRandomFloat() < change_rate)
+            ImGui::SetNextWindowFocus();
+        ImGui::Begin(name, NULL, flags);
+        ImGui::Text("Window %d", i);
+        if (HoverTestLayoutRandom(&seed) < 0.2f)
+        {
+            ImGui::SetCursorPos(ImVec2(HoverTestLayoutRandom(&seed) * 250.0f - 50.0f, HoverTestLayoutRandom(&seed) * 200.0f - 50.0f));
+            const ImVec2 child_size(20.0f + HoverTestLayoutRandom(&seed) * 250.0f, 20.0f + HoverTestLayoutRandom(&seed) * 150.0f);
+            ImGui::BeginChild("Child", child_size, ImGuiChildFlags_Border, (HoverTestLayoutRandom(&seed) < 0.2f) ? ImGuiWindowFlags_NoMouseInputs : 0);
+            ImGui::Text("Child");
+            ImGui::EndChild();
+        }
+        if (HoverTestLayoutRandom(&seed) < 0.05f)
+        {
+            const ImVec2 window_pos = ImGui::GetWindowPos();
+            ImGui::SetWindowHitTestHole(ImGui::GetCurrentWindow(), ImVec2(window_pos.x + 10.0f, window_pos.y + 10.0f), ImVec2(40.0f, 30.0f));
+        }
+        ImGui::End();
+    }
+}
+
+// Pick a point on the edge of a window's hit-testing rectangle, or anywhere
+static ImVec2 HoverTestRandomPos()
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    if (BenchRandomFloat() < 0.5f || g.Windows.Size == 0)
+        return ImVec2(BenchRandomFloat() * 1600.0f - 150.0f, BenchRandomFloat() * 1000.0f - 100.0f);
+    const ImGuiWindow* window = g.Windows[(int)(BenchRandomFloat() * g.Windows.Size)];
+    const ImRect& r = window->OuterRectClipped;
+    const float offsets[] = { 0.0f, -g.WindowsHoverPadding.x, +g.WindowsHoverPadding.x, -0.001f, +0.001f };
+    const float offset_x = offsets[(int)(BenchRandomFloat() * IM_ARRAYSIZE(offsets))];
+    const float offset_y = offsets[(int)(BenchRandomFloat() * IM_ARRAYSIZE(offsets))];
+    const float x = (BenchRandomFloat() < 0.5f) ? r.Min.x : r.Max.x;
+    const float y = (BenchRandomFloat() < 0.5f) ? r.Min.y : (BenchRandomFloat() < 0.5f) ? r.Max.y : (r.Min.y + r.Max.y) * 0.5f;
+    return ImVec2(x + offset_x, y + offset_y);
+}
+
+// Compare FindHoveredWindowEx() with and without grid, in both search modes, with and without a moving window
+static int HoverTestCompare(int queries_count)
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    int mismatches = 0;
+    for (int query_n = 0; query_n < queries_count; query_n++)
+    {
+        const ImVec2 pos = HoverTestRandomPos();
+        g.MovingWindow = (BenchRandomFloat() < 0.3f && g.Windows.Size > 0) ? g.Windows[(int)(BenchRandomFloat() * g.Windows.Size)] : NULL;
+        for (int find_first = 0; find_first < 2; find_first++)
+        {
+            ImGuiWindow* hovered[2];
+            ImGuiWindow* hovered_under_moving[2];
+            g.IO.ConfigWindowsHoverGrid = true;
+            ImGui::FindHoveredWindowEx(pos, find_first != 0, &hovered[0], &hovered_under_moving[0]);
+            g.IO.ConfigWindowsHoverGrid = false;
+            ImGui::FindHoveredWindowEx(pos, find_first != 0, &hovered[1], &hovered_under_moving[1]);
+            if (hovered[0] != hovered[1] || hovered_under_moving[0] != hovered_under_moving[1])
+                mismatches++;
+        }
+    }
+    g.MovingWindow = NULL;
+    g.IO.ConfigWindowsHoverGrid = true; // Keep grid enabled by NewFrame()
+    return mismatches;
+}
+
+// Node graph: thousands of child windows in one window
+static void HoverTestSubmitChildWindows(int columns, int rows)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Graph", NULL, ImGuiWindowFlags_NoDecoration);
+    const ImVec2 cell_size(1270.0f / columns, 710.0f / rows);
+    for (int n = 0; n < columns * rows; n++)
+    {
+        ImGui::SetCursorPos(ImVec2(5.0f + (n % columns) * cell_size.x, 5.0f + (n / columns) * cell_size.y));
+        ImGui::PushID(n);
+        ImGui::BeginChild("Node", ImVec2(cell_size.x - 2.0f, cell_size.y - 2.0f), ImGuiChildFlags_Border, ImGuiWindowFlags_NoScrollbar);
+        ImGui::EndChild();
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static int RunHoverTest()
+{
+    ImFontAtlas* font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    // Randomized equivalence test. Queries are made before, during and after submitting windows.
+    ImGui::CreateContext(font_atlas);
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.ConfigWindowsHoverGrid = true;
+    const int frames_count = 300;
+    const int queries_per_frame = 50;
+    int mismatches = 0;
+    int grid_reused_frames = 0;
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        io.DeltaTime = 1.0f / 60.0f;
+        if ((frame % 50) == 0)
+        {
+            ImGui::GetStyle().TouchExtraPadding = ImVec2((float)(frame / 50), (float)(frame / 100));
+            io.ConfigWindowsResizeFromEdges = ((frame / 50) & 1) == 0;
+        }
+        const int windows_count = 40 + ((frame / 16) * 56) % 400;
+        const float change_rate = (BenchRandomFloat() < 0.25f) ? 0.01f : 0.0f;
+        ImGui::NewFrame();
+        if (g.WindowsHoverGrid.Valid)
+            grid_reused_frames++;
+        mismatches += HoverTestCompare(queries_per_frame);
+        HoverTestSubmitWindows(0, windows_count / 2, frame, change_rate);
+        mismatches += HoverTestCompare(queries_per_frame);
+        HoverTestSubmitWindows(windows_count / 2, windows_count, frame, change_rate);
+        if (BenchRandomFloat() < change_rate * 50.0f)
+            ImGui::SetTooltip("Tooltip");
+        mismatches += HoverTestCompare(queries_per_frame);
+        ImGui::Render();
+        if ((frame % 30) == 29) // Style changed after building grid: grid can't be used
+            ImGui::GetStyle().TouchExtraPadding.x += 1.0f;
+        mismatches += HoverTestCompare(queries_per_frame);
+    }
+    ImGui::DestroyContext();
+    printf("hover_test: %d frames with 40..440 random windows, %d queries, grid reused from previous frame in %d frames\n", frames_count, frames_count * queries_per_frame * 4 * 2, grid_reused_frames);
+    printf("  mismatches: %d\n", mismatches);
+
+    // Timings with many child windows, in a still layout. NewFrame() searches the hovered window once per frame.
+    const int columns = 100, rows = 50;
+    ImGui::CreateContext(font_atlas);
+    ImGuiContext& g2 = *ImGui::GetCurrentContext();
+    ImGuiIO& io2 = ImGui::GetIO();
+    io2.IniFilename = NULL;
+    io2.DisplaySize = ImVec2(1280, 720);
+    io2.ConfigWindowsHoverGrid = true;
+    double search_time[3] = { 0.0, 0.0, 0.0 }; // First search after layout changed (linear), second search (builds grid), next searches
+    const int timed_frames = 10, timed_queries = 10000;
+    for (int frame = 0; frame < timed_frames + 2; frame++)
+    {
+        io2.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        HoverTestSubmitChildWindows(columns, rows);
+        ImGui::Render();
+        if (frame < 2)
+            continue; // Let window sizes settle
+        g2.WindowsHoverGrid.Invalidate();
+        ImGuiWindow* hovered_sum = NULL;
+        for (int query_n = 0; query_n < timed_queries + 2; query_n++)
+        {
+            ImGuiWindow* hovered;
+            const double t0 = GetTimeInSeconds();
+            ImGui::FindHoveredWindowEx(ImVec2(BenchRandomFloat() * 1280.0f, BenchRandomFloat() * 720.0f), false, &hovered, NULL);
+            search_time[ImMin(query_n, 2)] += GetTimeInSeconds() - t0;
+            hovered_sum = (hovered != NULL) ? hovered : hovered_sum;
+        }
+        IM_UNUSED(hovered_sum);
+    }
+    printf("hover_child_windows: %d child windows, grid %dx%d cells, still valid after %d frames: %s\n", columns * rows, g2.WindowsHoverGrid.CellsX, g2.WindowsHoverGrid.CellsY, timed_frames + 2, g2.WindowsHoverGrid.Valid ? "yes" : "no");
+    printf("  find hovered window: first search (linear) %8.3f us, second search (builds grid) %8.3f us, next searches %8.3f us\n",
+        search_time[0] * 1e6 / timed_frames, search_time[1] * 1e6 / timed_frames, search_time[2] * 1e6 / (timed_frames * timed_queries));
+    ImGui::DestroyContext();
+    IM_DELETE(font_atlas);
+    return (mismatches == 0 && grid_reused_frames > 0) ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// 32-bit indices (ImGuiBackendFlags_RendererHasIdx32)
+//-----------------------------------------------------------------------------
+
+// Windows with custom meshes over 64K vertices, using clipping rectangles, textures and callbacks.
+// Meshes are large in some frames only, and draw lists are merged in some frames only (io.ConfigMergeDrawLists),
+// so draw lists reused across frames (including the merged draw list) go from 16-bit to 32-bit indices and back.
+static void Idx32TestSubmitWindows(int frame)
+{
+    const bool large = (frame % 3) != 2;
+    for (int i = 0; i < 4; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Window %d", i);
+        ImGui::SetNextWindowPos(ImVec2((float)(i * 300), 0.0f));
+        ImGui::SetNextWindowSize(ImVec2(400.0f, 600.0f));
+        ImGui::Begin(name);
+        ImGui::Text("Frame %d", frame);
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 window_pos = ImGui::GetWindowPos();
+        const int shapes_count = (large && i != 3) ? 2000 + i * 1500 + frame * 10 : 100;
+        int clip_depth = 0;
+        for (int n = 0; n < shapes_count; n++)
+        {
+            const ImVec2 p(window_pos.x + (float)(n % 40) * 10.0f, window_pos.y + (float)(n / 40) * 2.0f);
+            if ((n % 1000) == 0)
+            {
+                draw_list->PushClipRect(ImVec2(p.x, p.y + (float)(n % 3) * 20.0f), ImVec2(p.x + 300.0f, p.y + 500.0f), true);
+                clip_depth++;
+            }
+            draw_list->AddCircleFilled(p, 4.0f + (float)(n % 3), IM_COL32(n & 255, (n * 7) & 255, i * 60, 255), 12);
+            if ((n % 1000) == 600)
+            {
+                draw_list->PopClipRect();
+                clip_depth--;
+            }
+            if ((n % 2500) == 7)
+                draw_list->AddImage((ImTextureID)(intptr_t)(n + 1), p, ImVec2(p.x + 16.0f, p.y + 16.0f));
+            if ((n % 1800) == 3)
+                draw_list->AddCallback(ImDrawCallback_ResetRenderState, NULL);
+        }
+        for (; clip_depth > 0; clip_depth--)
+            draw_list->PopClipRect();
+        ImGui::End();
+    }
+}
+
+// Consecutive de-indexed vertices using the same texture and clipping rectangle, or a callback
+struct Idx32TestRun
+{
+    int             VtxStart;
+    ImTextureID     TextureId;
+    ImVec4          ClipRect;
+    ImDrawCallback  UserCallback;
+};
+
+// Output vertices of all triangles in draw order, resolving 16-bit indices + ImDrawCmd::VtxOffset or ImDrawList::IdxBuffer32
+// like a renderer would. Runs are coalesced so splitting or merging draw commands doesn't change the output.
+// Return false on invalid draw data: both index buffers used, or indices out of bounds.
+static bool Idx32TestDeIndex(ImDrawData* draw_data, ImVector<ImDrawVert>* out_vtx, ImVector<Idx32TestRun>* out_runs, int* out_draw_calls)
+{
+    out_vtx->resize(0);
+    out_runs->resize(0);
+    *out_draw_calls = 0;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const bool use_idx32 = (draw_list->IdxBuffer32.Size > 0);
+        if (use_idx32 && draw_list->IdxBuffer.Size > 0)
+            return false;
+        const unsigned int idx_count = (unsigned int)(use_idx32 ? draw_list->IdxBuffer32.Size : draw_list->IdxBuffer.Size);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback == NULL && cmd.ElemCount == 0)
+                continue;
+            const Idx32TestRun* last_run = (out_runs->Size > 0) ? &out_runs->back() : NULL;
+            if (cmd.UserCallback != NULL || last_run == NULL || last_run->UserCallback != NULL || last_run->TextureId != cmd.TextureId || memcmp(&last_run->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) != 0)
+            {
+                Idx32TestRun run = { out_vtx->Size, cmd.TextureId, cmd.ClipRect, cmd.UserCallback };
+                out_runs->push_back(run);
+            }
+            if (cmd.UserCallback != NULL)
+                continue;
+            (*out_draw_calls)++;
+            if (cmd.IdxOffset + cmd.ElemCount > idx_count)
+                return false;
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+            {
+                const unsigned int vtx_n = use_idx32 ? draw_list->IdxBuffer32.Data[idx_n] : cmd.VtxOffset + draw_list->IdxBuffer.Data[idx_n];
+                if (vtx_n >= (unsigned int)draw_list->VtxBuffer.Size)
+                    return false;
+                out_vtx->push_back(draw_list->VtxBuffer.Data[vtx_n]);
+            }
+        }
+    }
+    return true;
+}
+
+static bool Idx32TestCompare(const ImVector<ImDrawVert>& vtx_a, const ImVector<Idx32TestRun>& runs_a, const ImVector<ImDrawVert>& vtx_b, const ImVector<Idx32TestRun>& runs_b)
+{
+    if (vtx_a.Size != vtx_b.Size || runs_a.Size != runs_b.Size)
+        return false;
+    if (vtx_a.Size > 0 && memcmp(vtx_a.Data, vtx_b.Data, (size_t)vtx_a.size_in_bytes()) != 0)
+        return false;
+    for (int n = 0; n < runs_a.Size; n++)
+    {
+        const Idx32TestRun& a = runs_a[n];
+        const Idx32TestRun& b = runs_b[n];
+        if (a.VtxStart != b.VtxStart || a.TextureId != b.TextureId || memcmp(&a.ClipRect, &b.ClipRect, sizeof(ImVec4)) != 0 || a.UserCallback != b.UserCallback)
+            return false;
+    }
+    return true;
+}
+
+// Compare de-indexed draw data of contexts using 32-bit indices for large draw lists, with a reference context using 16-bit indices + VtxOffset
+static int RunIdx32Test()
+{
+    ImFontAtlas* font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    const int contexts_count = 3;
+    const ImGuiBackendFlags contexts_flags[contexts_count] = { ImGuiBackendFlags_RendererHasVtxOffset, ImGuiBackendFlags_RendererHasIdx32, ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32 };
+    ImGuiContext* contexts[contexts_count];
+    for (int ctx_n = 0; ctx_n < contexts_count; ctx_n++)
+    {
+        contexts[ctx_n] = ImGui::CreateContext(font_atlas);
+        ImGui::SetCurrentContext(contexts[ctx_n]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1280, 720);
+        io.BackendFlags |= contexts_flags[ctx_n];
+    }
+
+    const int frames_count = 48;
+    int mismatches = 0;
+    int converted_frames = 0;   // Frames where at least one draw list uses 32-bit indices
+    int reverted_frames = 0;    // Frames where a draw list using 32-bit indices in the previous frame is back to 16-bit indices
+    int draw_calls[contexts_count] = {};
+    ImVector<ImDrawVert> vtx[contexts_count];
+    ImVector<Idx32TestRun> runs[contexts_count];
+    ImVector<ImDrawList*> converted_lists, prev_converted_lists;
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        bool valid = true;
+        bool reverted = false;
+        converted_lists.resize(0);
+        for (int ctx_n = 0; ctx_n < contexts_count; ctx_n++)
+        {
+            ImGui::SetCurrentContext(contexts[ctx_n]);
+            ImGuiIO& io = ImGui::GetIO();
+            io.DeltaTime = 1.0f / 60.0f;
+            io.ConfigMergeDrawLists = ((frame / 6) & 1) != 0;
+            ImGui::NewFrame();
+            Idx32TestSubmitWindows(frame);
+            ImGui::Render();
+            int frame_draw_calls = 0;
+            valid &= Idx32TestDeIndex(ImGui::GetDrawData(), &vtx[ctx_n], &runs[ctx_n], &frame_draw_calls);
+            draw_calls[ctx_n] += frame_draw_calls;
+            if (ctx_n == 1)
+                for (ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+                {
+                    if (draw_list->IdxBuffer32.Size > 0)
+                        converted_lists.push_back(draw_list);
+                    else if (prev_converted_lists.contains(draw_list))
+                        reverted = true;
+                }
+        }
+        converted_frames += (converted_lists.Size > 0) ? 1 : 0;
+        reverted_frames += reverted ? 1 : 0;
+        prev_converted_lists.swap(converted_lists);
+        for (int ctx_n = 1; ctx_n < contexts_count; ctx_n++)
+            valid &= Idx32TestCompare(vtx[0], runs[0], vtx[ctx_n], runs[ctx_n]);
+        if (!valid)
+        {
+            if (mismatches < 10)
+                printf("  mismatch at frame %d\n", frame);
+            mismatches++;
+        }
+    }
+    for (ImGuiContext* ctx : contexts)
+        ImGui::DestroyContext(ctx);
+    IM_DELETE(font_atlas);
+
+    // With '#define ImDrawIdx unsigned int' nothing is converted, we only check that output is identical
+    const bool coverage_ok = (sizeof(ImDrawIdx) == 4) || (converted_frames > 0 && converted_frames < frames_count && reverted_frames > 0);
+    printf("idx32_test: %d frames, draw lists using 32-bit indices in %d frames, back to 16-bit indices in %d frames\n", frames_count, converted_frames, reverted_frames);
+    printf("  draw calls: 16-bit indices + VtxOffset %d, 32-bit indices %d, both %d\n", draw_calls[0], draw_calls[1], draw_calls[2]);
+    printf("  de-indexed triangles identical: %s\n", (mismatches == 0) ? "yes" : "NO");
+    return (mismatches == 0 && coverage_ok) ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// OpenGL3 backend on a mock GL function table
+//-----------------------------------------------------------------------------
+
+// Compile the OpenGL3 backend here, with all vertex/index upload paths enabled, on top of a mock GL implementation:
+// imgui_impl_opengl3_loader.h declares GL functions as pointers in 'imgl3wProcs', which we fill ourselves instead of loading a GL library.
+// Buffer objects are stored in memory, and draw calls output the vertices of their triangles (like Idx32TestDeIndex() does).
+#define IMGUI_IMPL_OPENGL_LOADER_CUSTOM
+#define IMGUI_IMPL_OPENGL_ENABLE_SINGLE_UPLOAD
+#define IMGUI_IMPL_OPENGL_ENABLE_BUFFER_STORAGE
+#include "../../backends/imgui_impl_opengl3_loader.h"
+#include "../../backends/imgui_impl_opengl3.cpp"
+
+union ImGL3WProcs imgl3wProcs;
+
+struct MockGLDraw
+{
+    int             VtxStart;
+    GLuint          Texture;
+    GLint           Scissor[4];
+};
+
+struct MockGLState
+{
+    GLuint                  Version;                // Reported by glGetString(GL_VERSION), e.g. 330 for GL 3.3
+    ImVector<char>          Buffers[32];            // Contents of buffer objects, indexed by name (0 = no buffer)
+    bool                    BuffersUsed[32];
+    bool                    BuffersImmutable[32];   // Created with glBufferStorage()
+    GLuint                  ArrayBuffer;            // Bound to GL_ARRAY_BUFFER
+    GLuint                  ElementArrayBuffer;     // Bound to GL_ELEMENT_ARRAY_BUFFER
+    GLuint                  VertexBuffer;           // GL_ARRAY_BUFFER binding captured by glVertexAttribPointer()
+    GLuint                  Texture;
+    GLint                   Scissor[4];
+    GLuint                  NextName;               // For textures, shaders, programs, vertex arrays and fences
+    int                     UploadCount;            // glBufferData()/glBufferSubData() calls with data
+    int                     Errors;                 // Invalid calls
+    ImVector<ImDrawVert>    OutVtx;
+    ImVector<MockGLDraw>    OutDraws;
+};
+static MockGLState g_MockGL;
+
+static GLuint* MockGL_GetBinding(GLenum target)
+{
+    if (target == GL_ARRAY_BUFFER)
+        return &g_MockGL.ArrayBuffer;
+    if (target == GL_ELEMENT_ARRAY_BUFFER)
+        return &g_MockGL.ElementArrayBuffer;
+    return NULL;
+}
+
+static void APIENTRY MockGL_GenBuffers(GLsizei n, GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        buffers[i] = 0;
+        for (GLuint name = 1; name < IM_ARRAYSIZE(g_MockGL.Buffers) && buffers[i] == 0; name++)
+            if (!g_MockGL.BuffersUsed[name])
+            {
+                g_MockGL.BuffersUsed[name] = true;
+                g_MockGL.BuffersImmutable[name] = false;
+                buffers[i] = name;
+            }
+        if (buffers[i] == 0)
+            g_MockGL.Errors++;
+    }
+}
+
+static void APIENTRY MockGL_DeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        const GLuint name = buffers[i];
+        if (name == 0 || name >= IM_ARRAYSIZE(g_MockGL.Buffers))
+            continue;
+        g_MockGL.Buffers[name].clear();
+        g_MockGL.BuffersUsed[name] = false;
+        if (g_MockGL.ArrayBuffer == name)
+            g_MockGL.ArrayBuffer = 0;
+        if (g_MockGL.ElementArrayBuffer == name)
+            g_MockGL.ElementArrayBuffer = 0;
+    }
+}
+
+static void APIENTRY MockGL_BindBuffer(GLenum target, GLuint buffer)
+{
+    if (GLuint* binding = MockGL_GetBinding(target))
+        *binding = buffer;
+}
+
+static void APIENTRY MockGL_BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum)
+{
+    GLuint* binding = MockGL_GetBinding(target);
+    if (binding == NULL || *binding == 0 || g_MockGL.BuffersImmutable[*binding])
+    {
+        g_MockGL.Errors++;
+        return;
+    }
+    ImVector<char>& buf = g_MockGL.Buffers[*binding];
+    buf.resize((int)size);
+    if (data != NULL)
+    {
+        memcpy(buf.Data, data, (size_t)size);
+        g_MockGL.UploadCount++;
+    }
+}
+
+static void APIENTRY MockGL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    GLuint* binding = MockGL_GetBinding(target);
+    if (binding == NULL || *binding == 0 || offset + size > g_MockGL.Buffers[*binding].Size)
+    {
+        g_MockGL.Errors++;
+        return;
+    }
+    memcpy(g_MockGL.Buffers[*binding].Data + offset, data, (size_t)size);
+    g_MockGL.UploadCount++;
+}
+
+static void APIENTRY MockGL_BufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield)
+{
+    GLuint* binding = MockGL_GetBinding(target);
+    if (binding == NULL || *binding == 0 || g_MockGL.BuffersImmutable[*binding] || data != NULL)
+    {
+        g_MockGL.Errors++;
+        return;
+    }
+    g_MockGL.Buffers[*binding].resize((int)size);
+    g_MockGL.BuffersImmutable[*binding] = true;
+}
+
+static void* APIENTRY MockGL_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield)
+{
+    GLuint* binding = MockGL_GetBinding(target);
+    if (binding == NULL || *binding == 0 || !g_MockGL.BuffersImmutable[*binding] || offset + length > g_MockGL.Buffers[*binding].Size)
+    {
+        g_MockGL.Errors++;
+        return NULL;
+    }
+    return g_MockGL.Buffers[*binding].Data + offset;
+}
+
+static void APIENTRY MockGL_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)
+{
+    const ImVector<char>& idx_buf = g_MockGL.Buffers[g_MockGL.ElementArrayBuffer];
+    const ImVector<char>& vtx_buf = g_MockGL.Buffers[g_MockGL.VertexBuffer];
+    const size_t idx_size = (type == GL_UNSIGNED_INT) ? sizeof(ImU32) : sizeof(ImU16);
+    const size_t idx_offset = (size_t)(intptr_t)indices;
+    if (mode != GL_TRIANGLES || count < 0 || idx_offset % idx_size != 0 || idx_offset + (size_t)count * idx_size > (size_t)idx_buf.Size)
+    {
+        g_MockGL.Errors++;
+        return;
+    }
+    MockGLDraw draw = { g_MockGL.OutVtx.Size, g_MockGL.Texture, { g_MockGL.Scissor[0], g_MockGL.Scissor[1], g_MockGL.Scissor[2], g_MockGL.Scissor[3] } };
+    g_MockGL.OutDraws.push_back(draw);
+    for (GLsizei n = 0; n < count; n++)
+    {
+        ImU32 idx32 = 0;
+        ImU16 idx16 = 0;
+        if (type == GL_UNSIGNED_INT)
+            memcpy(&idx32, idx_buf.Data + idx_offset + (size_t)n * idx_size, idx_size);
+        else
+            memcpy(&idx16, idx_buf.Data + idx_offset + (size_t)n * idx_size, idx_size);
+        const ImS64 vtx_n = (ImS64)basevertex + ((type == GL_UNSIGNED_INT) ? idx32 : idx16);
+        if (vtx_n < 0 || (vtx_n + 1) * (ImS64)sizeof(ImDrawVert) > (ImS64)vtx_buf.Size)
+        {
+            g_MockGL.Errors++;
+            return;
+        }
+        ImDrawVert vtx;
+        memcpy(&vtx, vtx_buf.Data + vtx_n * (ImS64)sizeof(ImDrawVert), sizeof(ImDrawVert));
+        g_MockGL.OutVtx.push_back(vtx);
+    }
+}
+
+static void APIENTRY MockGL_DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    MockGL_DrawElementsBaseVertex(mode, count, type, indices, 0);
+}
+
+static void APIENTRY MockGL_GetIntegerv(GLenum pname, GLint* data)
+{
+    switch (pname)
+    {
+    case GL_MAJOR_VERSION:                  data[0] = (GLint)(g_MockGL.Version / 100); break;
+    case GL_MINOR_VERSION:                  data[0] = (GLint)(g_MockGL.Version / 10 % 10); break;
+    case GL_ARRAY_BUFFER_BINDING:           data[0] = (GLint)g_MockGL.ArrayBuffer; break;
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:   data[0] = (GLint)g_MockGL.ElementArrayBuffer; break;
+    case GL_TEXTURE_BINDING_2D:             data[0] = (GLint)g_MockGL.Texture; break;
+    case GL_POLYGON_MODE:                   data[0] = data[1] = GL_FILL; break;
+    case GL_VIEWPORT:
+    case GL_SCISSOR_BOX:                    data[0] = data[1] = data[2] = data[3] = 0; break;
+    default:                                data[0] = 0; break;
+    }
+}
+
+static const GLubyte* APIENTRY MockGL_GetString(GLenum name)
+{
+    static char version[16];
+    snprintf(version, sizeof(version), "%d.%d Mock", (int)(g_MockGL.Version / 100), (int)(g_MockGL.Version / 10 % 10));
+    return (const GLubyte*)(name == GL_VERSION ? version : "Mock");
+}
+
+static GLint APIENTRY MockGL_GetAttribLocation(GLuint, const GLchar* name)
+{
+    return (strcmp(name, "Position") == 0) ? 0 : (strcmp(name, "UV") == 0) ? 1 : (strcmp(name, "Color") == 0) ? 2 : -1;
+}
+
+static GLuint APIENTRY MockGL_CreateShader(GLenum)                          { return ++g_MockGL.NextName; }
+static GLuint APIENTRY MockGL_CreateProgram()                               { return ++g_MockGL.NextName; }
+static void APIENTRY MockGL_GenNames(GLsizei n, GLuint* names)              { for (GLsizei i = 0; i < n; i++) names[i] = ++g_MockGL.NextName; }
+static void APIENTRY MockGL_DeleteNames(GLsizei, const GLuint*)             {}
+static GLsync APIENTRY MockGL_FenceSync(GLenum, GLbitfield)                 { return (GLsync)(intptr_t)++g_MockGL.NextName; }
+static GLenum APIENTRY MockGL_ClientWaitSync(GLsync, GLbitfield, GLuint64)  { return GL_ALREADY_SIGNALED; }
+static void APIENTRY MockGL_DeleteSync(GLsync)                              {}
+static void APIENTRY MockGL_GetStatusiv(GLuint, GLenum pname, GLint* params) { *params = (pname == GL_COMPILE_STATUS || pname == GL_LINK_STATUS) ? GL_TRUE : 0; }
+static void APIENTRY MockGL_GetInfoLog(GLuint, GLsizei, GLsizei* length, GLchar* info_log) { if (length) *length = 0; if (info_log) *info_log = 0; }
+static GLint APIENTRY MockGL_GetUniformLocation(GLuint, const GLchar* name) { return (strcmp(name, "Texture") == 0) ? 0 : 1; }
+static GLenum APIENTRY MockGL_GetError()                                    { return 0; }
+static GLboolean APIENTRY MockGL_IsEnabled(GLenum)                          { return GL_FALSE; }
+static GLboolean APIENTRY MockGL_IsProgram(GLuint)                          { return GL_TRUE; }
+static void APIENTRY MockGL_BindTexture(GLenum, GLuint texture)             { g_MockGL.Texture = texture; }
+static void APIENTRY MockGL_Scissor(GLint x, GLint y, GLsizei w, GLsizei h) { g_MockGL.Scissor[0] = x; g_MockGL.Scissor[1] = y; g_MockGL.Scissor[2] = w; g_MockGL.Scissor[3] = h; }
+static void APIENTRY MockGL_VertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei stride, const void*) { g_MockGL.VertexBuffer = g_MockGL.ArrayBuffer; if (stride != (GLsizei)sizeof(ImDrawVert)) g_MockGL.Errors++; }
+static void APIENTRY MockGL_Enum(GLenum)                                    {}
+static void APIENTRY MockGL_Enum2(GLenum, GLenum)                           {}
+static void APIENTRY MockGL_Enum4(GLenum, GLenum, GLenum, GLenum)           {}
+static void APIENTRY MockGL_Name(GLuint)                                    {}
+static void APIENTRY MockGL_Name2(GLuint, GLuint)                           {}
+static void APIENTRY MockGL_Viewport(GLint, GLint, GLsizei, GLsizei)        {}
+static void APIENTRY MockGL_PixelStorei(GLenum, GLint)                      {}
+static void APIENTRY MockGL_TexParameteri(GLenum, GLenum, GLint)            {}
+static void APIENTRY MockGL_TexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) {}
+static void APIENTRY MockGL_TexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*) {}
+static void APIENTRY MockGL_ShaderSource(GLuint, GLsizei, const GLchar* const*, const GLint*) {}
+static void APIENTRY MockGL_Uniform1i(GLint, GLint)                         {}
+static void APIENTRY MockGL_UniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*) {}
+
+static void MockGL_Init(GLuint version)
+{
+    g_MockGL.Version = version;
+    glActiveTexture = MockGL_Enum;
+    glAttachShader = MockGL_Name2;
+    glBindBuffer = MockGL_BindBuffer;
+    glBindSampler = MockGL_Name2;
+    glBindTexture = MockGL_BindTexture;
+    glBindVertexArray = MockGL_Name;
+    glBlendEquation = MockGL_Enum;
+    glBlendEquationSeparate = MockGL_Enum2;
+    glBlendFuncSeparate = MockGL_Enum4;
+    glBufferData = MockGL_BufferData;
+    glBufferStorage = MockGL_BufferStorage;
+    glBufferSubData = MockGL_BufferSubData;
+    glClientWaitSync = MockGL_ClientWaitSync;
+    glCompileShader = MockGL_Name;
+    glCreateProgram = MockGL_CreateProgram;
+    glCreateShader = MockGL_CreateShader;
+    glDeleteBuffers = MockGL_DeleteBuffers;
+    glDeleteProgram = MockGL_Name;
+    glDeleteShader = MockGL_Name;
+    glDeleteSync = MockGL_DeleteSync;
+    glDeleteTextures = MockGL_DeleteNames;
+    glDeleteVertexArrays = MockGL_DeleteNames;
+    glDetachShader = MockGL_Name2;
+    glDisable = MockGL_Enum;
+    glDisableVertexAttribArray = MockGL_Name;
+    glDrawElements = MockGL_DrawElements;
+    glDrawElementsBaseVertex = MockGL_DrawElementsBaseVertex;
+    glEnable = MockGL_Enum;
+    glEnableVertexAttribArray = MockGL_Name;
+    glFenceSync = MockGL_FenceSync;
+    glGenBuffers = MockGL_GenBuffers;
+    glGenTextures = MockGL_GenNames;
+    glGenVertexArrays = MockGL_GenNames;
+    glGetAttribLocation = MockGL_GetAttribLocation;
+    glGetError = MockGL_GetError;
+    glGetIntegerv = MockGL_GetIntegerv;
+    glGetProgramInfoLog = MockGL_GetInfoLog;
+    glGetProgramiv = MockGL_GetStatusiv;
+    glGetShaderInfoLog = MockGL_GetInfoLog;
+    glGetShaderiv = MockGL_GetStatusiv;
+    glGetString = MockGL_GetString;
+    glGetUniformLocation = MockGL_GetUniformLocation;
+    glIsEnabled = MockGL_IsEnabled;
+    glIsProgram = MockGL_IsProgram;
+    glLinkProgram = MockGL_Name;
+    glMapBufferRange = MockGL_MapBufferRange;
+    glPixelStorei = MockGL_PixelStorei;
+    glPolygonMode = MockGL_Enum2;
+    glScissor = MockGL_Scissor;
+    glShaderSource = MockGL_ShaderSource;
+    glTexImage2D = MockGL_TexImage2D;
+    glTexParameteri = MockGL_TexParameteri;
+    glTexSubImage2D = MockGL_TexSubImage2D;
+    glUniform1i = MockGL_Uniform1i;
+    glUniformMatrix4fv = MockGL_UniformMatrix4fv;
+    glUseProgram = MockGL_Name;
+    glVertexAttribPointer = MockGL_VertexAttribPointer;
+    glViewport = MockGL_Viewport;
+}
+
+// Check the CPU side of single upload: ImGui_ImplOpenGL3_UpdateUploadBuffer() reports changes and keeps a copy of last uploaded data,
+// and concatenating draw lists with it gives the same data as ImGui_ImplOpenGL3_CopyDrawData() writes to the ring buffer.
+static bool OpenGL3TestUploadBuffers(const ImDrawData* draw_data)
+{
+    bool ok = true;
+    ImVector<char> buf;
+    int offset = 0;
+    ok &= ImGui_ImplOpenGL3_UpdateUploadBuffer(&buf, &offset, "abcdef", 6, false) == true;     // Grows
+    offset = 0;
+    ok &= ImGui_ImplOpenGL3_UpdateUploadBuffer(&buf, &offset, "abcdef", 6, false) == false;    // Identical
+    offset = 0;
+    ok &= ImGui_ImplOpenGL3_UpdateUploadBuffer(&buf, &offset, "abcxef", 6, false) == true;     // Modified
+    ok &= (offset == 6 && memcmp(buf.Data, "abcxef", 6) == 0);
+    ok &= ImGui_ImplOpenGL3_UpdateUploadBuffer(&buf, &offset, "", 0, true) == true;            // Once changed, stays changed
+
+    ImVector<char> upload_vtx, upload_idx;
+    int vtx_offset = 0, idx_offset = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        ImGui_ImplOpenGL3_UpdateUploadBuffer(&upload_vtx, &vtx_offset, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.size_in_bytes(), false);
+        ImGui_ImplOpenGL3_UpdateUploadBuffer(&upload_idx, &idx_offset, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.size_in_bytes(), false);
+    }
+    ImVector<ImDrawVert> copy_vtx;
+    ImVector<ImDrawIdx> copy_idx;
+    copy_vtx.resize(draw_data->TotalVtxCount);
+    copy_idx.resize(draw_data->TotalIdxCount);  // Also counts 32-bit indices, which are not copied
+    ImGui_ImplOpenGL3_CopyDrawData(draw_data, copy_vtx.Data, copy_idx.Data);
+    ok &= (vtx_offset == copy_vtx.size_in_bytes() && idx_offset <= copy_idx.size_in_bytes());
+    ok &= (vtx_offset == 0 || memcmp(upload_vtx.Data, copy_vtx.Data, (size_t)vtx_offset) == 0);
+    ok &= (idx_offset == 0 || memcmp(upload_idx.Data, copy_idx.Data, (size_t)idx_offset) == 0);
+    return ok;
+}
+
+// Render the windows of the '--idx32' test with the OpenGL3 backend on the mock GL, with each upload path in its own context:
+// the triangles drawn with single upload and with the ring buffer must be identical to those drawn with the default path
+// (two glBufferData() calls per draw list), which must be identical to the de-indexed draw data.
+// Each frame is rendered twice, so the second render has nothing to upload with single upload.
+static int RunOpenGL3Test()
+{
+    ImFontAtlas* font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    enum { Path_Default, Path_SingleUpload, Path_RingBuffer, Path_COUNT };
+    const GLuint paths_gl_version[Path_COUNT] = { 330, 330, 450 };
+    ImGuiContext* contexts[Path_COUNT];
+    bool valid_setup = true;
+    for (int path = 0; path < Path_COUNT; path++)
+    {
+        contexts[path] = ImGui::CreateContext(font_atlas);
+        ImGui::SetCurrentContext(contexts[path]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1280, 720);
+        MockGL_Init(paths_gl_version[path]);
+        valid_setup &= ImGui_ImplOpenGL3_Init(NULL);
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        if (path == Path_Default)
+            bd->UseSingleUpload = false;
+        valid_setup &= (bd->UseSingleUpload == (path != Path_Default)) && (bd->UseBufferStorage == (path == Path_RingBuffer));
+        valid_setup &= (io.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates) != 0;
+    }
+
+    // Create device objects of all contexts before the first frame: they share a font atlas, so the last created font texture is used by all
+    for (ImGuiContext* ctx : contexts)
+    {
+        ImGui::SetCurrentContext(ctx);
+        ImGui_ImplOpenGL3_NewFrame();
+    }
+
+    const int frames_count = 48;
+    int mismatches = 0;
+    bool valid_uploads = true;
+    int uploads[Path_COUNT][2] = {};
+    ImVector<ImDrawVert> ref_vtx;
+    ImVector<Idx32TestRun> ref_runs;
+    ImVector<ImDrawVert> out_vtx[Path_COUNT][2];
+    ImVector<MockGLDraw> out_draws[Path_COUNT][2];
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        bool valid = true;
+        for (int path = 0; path < Path_COUNT; path++)
+        {
+            ImGui::SetCurrentContext(contexts[path]);
+            ImGuiIO& io = ImGui::GetIO();
+            io.DeltaTime = 1.0f / 60.0f;
+            io.ConfigMergeDrawLists = ((frame / 6) & 1) != 0;
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui::NewFrame();
+            Idx32TestSubmitWindows(frame);
+            ImGui::Render();
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            int idx32_draw_lists = 0;
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                idx32_draw_lists += (draw_list->IdxBuffer32.Size > 0) ? 1 : 0;
+            if (path == Path_Default)
+            {
+                int draw_calls = 0;
+                valid &= Idx32TestDeIndex(draw_data, &ref_vtx, &ref_runs, &draw_calls);
+                valid &= OpenGL3TestUploadBuffers(draw_data);
+            }
+            for (int render_n = 0; render_n < 2; render_n++)
+            {
+                g_MockGL.UploadCount = 0;
+                g_MockGL.OutVtx.resize(0);
+                g_MockGL.OutDraws.resize(0);
+                ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+                out_vtx[path][render_n].swap(g_MockGL.OutVtx);
+                out_draws[path][render_n].swap(g_MockGL.OutDraws);
+                uploads[path][render_n] += g_MockGL.UploadCount;
+
+                // Default path: 2 uploads per draw list. Single upload: 1 per buffer, skipped when unchanged. Ring buffer: none.
+                // With single upload and ring buffer, 32-bit indices are uploaded separately for each draw list using them.
+                if (path == Path_Default)
+                    valid_uploads &= (g_MockGL.UploadCount == draw_data->CmdListsCount * 2);
+                else if (path == Path_SingleUpload)
+                    valid_uploads &= (render_n == 0) ? (g_MockGL.UploadCount <= 2 + idx32_draw_lists) : (g_MockGL.UploadCount == idx32_draw_lists);
+                else
+                    valid_uploads &= (g_MockGL.UploadCount == idx32_draw_lists);
+            }
+        }
+        valid &= (out_vtx[Path_Default][0].Size == ref_vtx.Size) && (ref_vtx.Size == 0 || memcmp(out_vtx[Path_Default][0].Data, ref_vtx.Data, (size_t)ref_vtx.size_in_bytes()) == 0);
+        for (int path = 0; path < Path_COUNT; path++)
+            for (int render_n = 0; render_n < 2; render_n++)
+            {
+                const ImVector<ImDrawVert>& vtx = out_vtx[path][render_n];
+                const ImVector<MockGLDraw>& draws = out_draws[path][render_n];
+                valid &= (vtx.Size == ref_vtx.Size) && (ref_vtx.Size == 0 || memcmp(vtx.Data, out_vtx[Path_Default][0].Data, (size_t)vtx.size_in_bytes()) == 0);
+                valid &= (draws.Size == out_draws[Path_Default][0].Size) && (draws.Size == 0 || memcmp(draws.Data, out_draws[Path_Default][0].Data, (size_t)draws.size_in_bytes()) == 0);
+            }
+        if (!valid)
+        {
+            if (mismatches < 10)
+                printf("  mismatch at frame %d\n", frame);
+            mismatches++;
+        }
+    }
+
+    for (ImGuiContext* ctx : contexts)
+    {
+        ImGui::SetCurrentContext(ctx);
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui::DestroyContext(ctx);
+    }
+    IM_DELETE(font_atlas);
+    bool leaked_buffers = false;
+    for (bool used : g_MockGL.BuffersUsed)
+        leaked_buffers |= used;
+
+    printf("opengl3_test: %d frames, each rendered twice\n", frames_count);
+    printf("  uploads per frame: default %.1f, single upload %.1f (%.1f when unchanged), ring buffer %.1f\n",
+        (double)uploads[Path_Default][0] / frames_count, (double)uploads[Path_SingleUpload][0] / frames_count, (double)uploads[Path_SingleUpload][1] / frames_count, (double)uploads[Path_RingBuffer][0] / frames_count);
+    printf("  drawn triangles identical: %s, expected uploads: %s, GL errors: %d, leaked buffers: %s\n",
+        (mismatches == 0) ? "yes" : "NO", valid_uploads ? "yes" : "NO", g_MockGL.Errors, leaked_buffers ? "YES" : "no");
+    return (valid_setup && mismatches == 0 && valid_uploads && g_MockGL.Errors == 0 && !leaked_buffers) ? 0 : 1;
+}
+
+static bool IsWorkloadSelected(const char* selection, const char* name)
+{
+    if (selection == NULL)
+        return true;
+    const size_t name_len = strlen(name);
+    for (const char* p = selection; *p; )
+    {
+        const char* p_end = strchr(p, ',');
+        const size_t len = p_end ? (size_t)(p_end - p) : strlen(p);
+        if (len == name_len && strncmp(p, name, len) == 0)
+            return true;
+        p += len + (p_end ? 1 : 0);
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    int frames = 100;
+    int warmup_frames = 10;
+    const char* selection = NULL;
+    const char* format = "text";
+    bool font_build = false;
+    bool dynamic_glyphs_test = false;
+    bool idle_session = false;
+    bool hover_test = false;
+    bool idx32_test = false;
+    bool opengl3_test = false;
+    int thread_count = (int)std::thread::hardware_concurrency();
+    const char* font_file = NULL;
+    for (int n = 1; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(arg, "--frames") == 0 && has_value)
+            frames = atoi(argv[++n]);
+        else if (strcmp(arg, "--warmup") == 0 && has_value)
+            warmup_frames = atoi(argv[++n]);
+        else if (strcmp(arg, "--workload") == 0 && has_value)
+            selection = argv[++n];
+        else if (strcmp(arg, "--format") == 0 && has_value)
+            format = argv[++n];
+        else if (strcmp(arg, "--fonts") == 0)
+            font_build = true;
+        else if (strcmp(arg, "--glyphs") == 0)
+            dynamic_glyphs_test = true;
+        else if (strcmp(arg, "--idle") == 0)
+            idle_session = true;
+        else if (strcmp(arg, "--hover") == 0)
+            hover_test = true;
+        else if (strcmp(arg, "--idx32") == 0)
+            idx32_test = true;
+        else if (strcmp(arg, "--opengl3") == 0)
+            opengl3_test = true;
+        else if (strcmp(arg, "--threads") == 0 && has_value)
+            thread_count = atoi(argv[++n]);
+        else if (strcmp(arg, "--font-file") == 0 && has_value)
+            font_file = argv[++n];
+        else if (strcmp(arg, "--list") == 0)
+        {
+            for (const BenchWorkload& workload : g_Workloads)
+                printf("%s\n", workload.Name);
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--workload NAME[,NAME...]] [--format text|json|csv] [--threads N] [--list]\n", argv[0]);
+            fprintf(stderr, "       %s --fonts [--threads N] [--font-file FILE.ttf]\n", argv[0]);
+            fprintf(stderr, "       %s --glyphs [--font-file FILE.ttf]\n", argv[0]);
+            fprintf(stderr, "       %s --idle\n", argv[0]);
+            fprintf(stderr, "       %s --hover\n", argv[0]);
+            fprintf(stderr, "       %s --idx32\n", argv[0]);
+            fprintf(stderr, "       %s --opengl3\n", argv[0]);
+            return 1;
+        }
+    }
+
+    IMGUI_CHECKVERSION();
+    if (font_build)
+        return RunFontBuild(thread_count > 1 ? thread_count : 2, font_file); // Measure with default allocators
+    if (dynamic_glyphs_test)
+        return RunDynamicGlyphsTest(font_file);
+    if (idle_session)
+        return RunIdleSession();
+    if (hover_test)
+        return RunHoverTest();
+    if (idx32_test)
+        return RunIdx32Test();
+    if (opengl3_test)
+        return RunOpenGL3Test();
+    ImGui::SetAllocatorFunctions(BenchMallocWrapper, BenchFreeWrapper, &g_AllocStats);
+    g_ThreadCount = thread_count > 1 ? thread_count : 1;
+
+    // Build atlas once, shared by all workloads
+    ImFontAtlas* font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    int results_count = 0;
+    for (const BenchWorkload& workload : g_Workloads)
+    {
+        if (!IsWorkloadSelected(selection, workload.Name))
+            continue;
+        BenchResult result;
+        RunWorkload(workload, font_atlas, warmup_frames, frames, &result);
+        PrintResult(result, format, results_count == 0);
+        results_count++;
+    }
+    if (strcmp(format, "json") == 0)
+        printf(results_count > 0 ? "\n]\n" : "[]\n");
+
+    IM_DELETE(font_atlas);
+    if (results_count == 0)
+    {
+        fprintf(stderr, "No workload matching '%s'. Use --list to list available workloads.\n", selection ? selection : "");
+        return 1;
+    }
+    return 0;
+}
@@ -49,6 +49,11 @@
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Select the hash function used for ImGuiID (default is CRC32 using a 1KB lookup table, byte-at-a-time)
+// Changing the hash function will change all IDs, so settings stored by ID in .ini files (e.g. tables) will be reset once.
+//#define IMGUI_USE_FAST_HASH                               // Use a word-at-a-time multiply/rotate hash (no lookup table).
+//#define IMGUI_USE_CRC32C_HASH                             // Use hardware CRC32C instructions. Requires SSE 4.2 (e.g. -msse4.2) or ARMv8 CRC32 (e.g. -march=armv8-a+crc).
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -70,9 +70,9 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
-// [SECTION] ImGuiTextFilter
+// [SECTION] ImGuiTextFilter, ImGuiTextFilterIndex
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
-// [SECTION] ImGuiListClipper
+// [SECTION] ImGuiListClipper, ImGuiListClipperHeights
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] INITIALIZATION, SHUTDOWN
@@ -1042,6 +1042,22 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// Hash function selection (see IMGUI_USE_FAST_HASH / IMGUI_USE_CRC32C_HASH in imconfig.h)
+#if defined(IMGUI_USE_FAST_HASH) && defined(IMGUI_USE_CRC32C_HASH)
+#error "Define only one of IMGUI_USE_FAST_HASH or IMGUI_USE_CRC32C_HASH"
+#endif
+#if defined(IMGUI_USE_CRC32C_HASH)
+#if defined(__SSE4_2__) || defined(__AVX__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <nmmintrin.h>      // _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+#define IMGUI_HASH_CRC32C_SSE42
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>       // __crc32cb, __crc32cw, __crc32cd
+#define IMGUI_HASH_CRC32C_ARM
+#else
+#error "IMGUI_USE_CRC32C_HASH requires SSE 4.2 (e.g. -msse4.2) or ARMv8 CRC32 instructions (e.g. -march=armv8-a+crc)"
+#endif
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1099,6 +1115,7 @@ static const float NAV_ACTIVATE_HIGHLIGHT_TIMER             = 0.10f;    // Time
 static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Extend outside window for hovering/resizing (maxxed with TouchPadding) and inside windows for borders. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const int   WINDOWS_HOVER_GRID_MIN_COUNT             = 64;       // Minimum number of hoverable windows to build io.ConfigWindowsHoverGrid index. Below this, a linear search is about as fast.
 
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET = ImVec2(16, 10);            // Multiplied by g.Style.MouseCursorScale
@@ -1166,6 +1183,7 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateWindowsHoverGrid(const ImVec2& padding_regular, const ImVec2& padding_for_resize);
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1362,6 +1380,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigWindowsHoverGrid = false;
+    ConfigMergeDrawLists = false;
+    ConfigTextLayoutCache = false;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
 
@@ -1378,6 +1399,7 @@ ImGuiIO::ImGuiIO()
     for (int i = 0; i < IM_ARRAYSIZE(MouseDownDuration); i++) MouseDownDuration[i] = MouseDownDurationPrev[i] = -1.0f;
     for (int i = 0; i < IM_ARRAYSIZE(KeysData); i++) { KeysData[i].DownDuration = KeysData[i].DownDurationPrev = -1.0f; }
     AppAcceptingEvents = true;
+    WantRefresh = true;
     BackendUsingLegacyKeyArrays = (ImS8)-1;
     BackendUsingLegacyNavInputArray = true; // assume using legacy array until proven wrong
 }
@@ -1934,12 +1956,66 @@ const ImWchar* ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin)
     return buf_mid_line;
 }
 
+#ifdef IMGUI_ENABLE_SSE2
+// Convert a block of 16 characters with ImToUpper()
+static inline __m128i ImToUpperBlock16(const char* p)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)p);
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1))); // Signed compare: bytes >= 0x80 are never lower-case
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+}
+#endif
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + strlen(needle);
 
     const char un0 = (char)ImToUpper(*needle);
+#ifdef IMGUI_ENABLE_SSE2
+    // Fast path: test 16 positions at a time, comparing first and last characters of needle, then compare the rest on candidates.
+    // The last block is aligned on the last position where needle fits in haystack, ignoring positions already tested.
+    // Remaining positions (where needle doesn't fit in haystack) are processed below.
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len > 0)
+    {
+        if (!haystack_end)
+            haystack_end = haystack + strlen(haystack);
+        if (haystack_end - haystack >= 16 + needle_len - 1)
+        {
+            const __m128i first = _mm_set1_epi8(un0);
+            const __m128i last = _mm_set1_epi8((char)ImToUpper(needle_end[-1]));
+            const char* block_last = haystack_end - (16 + needle_len - 1);
+            for (const char* block = haystack; ; block += 16)
+            {
+                unsigned int ignore_mask = 0;
+                if (block > block_last)
+                {
+                    ignore_mask = (1u << (block - block_last)) - 1;
+                    block = block_last;
+                }
+                const __m128i eq_first = _mm_cmpeq_epi8(ImToUpperBlock16(block), first);
+                const __m128i eq_last = _mm_cmpeq_epi8(ImToUpperBlock16(block + needle_len - 1), last);
+                for (unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)) & ~ignore_mask; mask != 0; mask &= mask - 1)
+                {
+                    int n = 0;
+                    while ((mask & (1u << n)) == 0)
+                        n++;
+                    const char* a = block + n + 1;
+                    const char* b = needle + 1;
+                    for (; b < needle_end - 1; a++, b++)
+                        if (ImToUpper(*a) != ImToUpper(*b))
+                            break;
+                    if (b >= needle_end - 1)
+                        return block + n;
+                }
+                if (block == block_last)
+                    break;
+            }
+            haystack = block_last + 16;
+        }
+    }
+#endif
     while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
     {
         if (ImToUpper(*haystack) == un0)
@@ -2076,6 +2152,45 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
+// The hash function used for ImGuiID is selected at compile-time:
+// - Default:                CRC32 using a 1KB lookup table. Stable across platforms and versions, used by .ini data storing IDs.
+// - IMGUI_USE_FAST_HASH:    32-bit word-at-a-time multiply/rotate hash (MurmurHash3-style mixing). No lookup table.
+// - IMGUI_USE_CRC32C_HASH:  CRC32C using hardware instructions (SSE 4.2 or ARMv8), 4/8 bytes at a time.
+// Changing the hash function changes all IDs. Settings stored with an ID in .ini data (e.g. tables) will be discarded on the first run.
+// The non-default hashes read words in native byte order, so their output differ between little-endian and big-endian platforms.
+
+static inline ImU32 ImHashRotl32(ImU32 v, int r) { return (v << r) | (v >> (32 - r)); }
+static inline ImU32 ImHashLoad32(const unsigned char* p) { ImU32 v; memcpy(&v, p, 4); return v; }
+
+// Word-at-a-time multiply/rotate hash, used by ImHashData() with IMGUI_USE_FAST_HASH.
+// Always available for keys which are never stored (e.g. text layout cache), where the default CRC32 would dominate lookup costs.
+ImU32 ImHashDataFast(const void* data_p, size_t data_size, ImU32 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    const ImU32 c1 = 0xCC9E2D51, c2 = 0x1B873593;
+    ImU32 h = seed;
+    for (size_t n = data_size >> 2; n != 0; n--, data += 4)
+    {
+        ImU32 k = ImHashLoad32(data) * c1;
+        h ^= ImHashRotl32(k, 15) * c2;
+        h = ImHashRotl32(h, 13) * 5 + 0xE6546B64;
+    }
+    if (data_size & 3)
+    {
+        ImU32 k = 0;
+        for (size_t n = data_size & 3; n != 0; n--)
+            k = (k << 8) | data[n - 1];
+        h ^= ImHashRotl32(k * c1, 15) * c2;
+    }
+    h ^= (ImU32)data_size;
+    h ^= h >> 16; h *= 0x85EBCA6B;
+    h ^= h >> 13; h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
+#if !defined(IMGUI_USE_FAST_HASH) && !defined(IMGUI_USE_CRC32C_HASH)
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2101,7 +2216,6 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
     ImU32 crc = ~seed;
@@ -2117,7 +2231,6 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
     seed = ~seed;
@@ -2146,6 +2259,66 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#else
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+#if defined(IMGUI_USE_FAST_HASH)
+    return ImHashDataFast(data_p, data_size, seed);
+#elif defined(IMGUI_HASH_CRC32C_SSE42)
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU32 crc = ~seed;
+#if defined(__x86_64__) || defined(_M_X64)
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v; memcpy(&v, data, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+#endif
+    for (; data_size >= 4; data_size -= 4, data += 4)
+        crc = _mm_crc32_u32(crc, ImHashLoad32(data));
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return ~crc;
+#elif defined(IMGUI_HASH_CRC32C_ARM)
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU32 crc = ~seed;
+#if defined(__aarch64__)
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v; memcpy(&v, data, 8);
+        crc = __crc32cd(crc, v);
+    }
+#endif
+    for (; data_size >= 4; data_size -= 4, data += 4)
+        crc = __crc32cw(crc, ImHashLoad32(data));
+    while (data_size-- != 0)
+        crc = __crc32cb(crc, *data++);
+    return ~crc;
+#endif
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// - Equivalent to the byte-wise CRC32 version: hashing restarts from the seed at the last "###" occurrence.
+// - We first locate the end of the string (strlen) and the last "###" (memchr), then hash the remaining range in one go.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            data_p = p;
+    return ImHashData(data_p, (size_t)(data_end - data_p), seed);
+}
+
+#endif // #if !defined(IMGUI_USE_FAST_HASH) && !defined(IMGUI_USE_CRC32C_HASH)
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2287,13 +2460,70 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Fast path for ASCII text: process blocks of 16 bytes.
+// We only use it when the end of text is known, as we can't read past a zero-terminator.
+#ifdef IMGUI_ENABLE_SSE2
+// Return number of leading non-zero ASCII characters in a block of 16 bytes.
+static inline int ImTextCountAsciiCharsInBlock16(const char* in_text)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+    const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, _mm_setzero_si128()))); // Bit set for bytes >= 0x80 or == 0
+    if (mask == 0)
+        return 16;
+    int n = 0;
+    while ((mask & (1u << n)) == 0)
+        n++;
+    return n;
+}
+
+// Convert a block of 16 ASCII characters
+static inline void ImTextStrFromAsciiBlock16(ImWchar* out_buf, const char* in_text)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+#ifdef IMGUI_USE_WCHAR32
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 0), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 12), _mm_unpackhi_epi16(hi, zero));
+#else
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 0), lo);
+    _mm_storeu_si128((__m128i*)(void*)(out_buf + 8), hi);
+#endif
+}
+#endif // #ifdef IMGUI_ENABLE_SSE2
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
-        unsigned int c;
+        unsigned int c = (unsigned char)*in_text;
+        if (c < 0x80)
+        {
+#ifdef IMGUI_ENABLE_SSE2
+            if (in_text_end != NULL && in_text_end - in_text >= 16 && buf_end - buf_out > 16)
+            {
+                const int ascii_count = ImTextCountAsciiCharsInBlock16(in_text);
+                if (ascii_count == 16)
+                {
+                    ImTextStrFromAsciiBlock16(buf_out, in_text);
+                    in_text += 16;
+                    buf_out += 16;
+                    continue;
+                }
+                for (int n = 0; n < ascii_count - 1; n++) // Last one is copied below
+                    *buf_out++ = (ImWchar)(unsigned char)*in_text++;
+                c = (unsigned char)*in_text;
+            }
+#endif
+            *buf_out++ = (ImWchar)c;
+            in_text++;
+            continue;
+        }
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         *buf_out++ = (ImWchar)c;
     }
@@ -2308,6 +2538,21 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
     int char_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        if ((unsigned char)*in_text < 0x80)
+        {
+#ifdef IMGUI_ENABLE_SSE2
+            if (in_text_end != NULL && in_text_end - in_text >= 16)
+            {
+                const int ascii_count = ImTextCountAsciiCharsInBlock16(in_text);
+                in_text += ascii_count;
+                char_count += ascii_count;
+                continue;
+            }
+#endif
+            in_text++;
+            char_count++;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         char_count++;
@@ -2542,6 +2787,76 @@ ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_
     return in_p;
 }
 
+// Open-addressing index, used when ImGuiStorage::UseHashTable is set.
+// Keys are generally already hashed IDs, but may be user-provided sequential values, so we mix them once more.
+static inline ImU32 ImGuiStorageHashKey(ImGuiID key)
+{
+    key ^= key >> 16;
+    key *= 0x85EBCA6B;
+    key ^= key >> 13;
+    return key;
+}
+
+// Return index in HashTable[] of the slot holding 'key', or of the empty slot where it should be inserted.
+static int ImGuiStorageHashFindSlot(const ImGuiStorage* storage, ImGuiID key)
+{
+    const int mask = storage->HashTable.Size - 1;
+    for (int slot = (int)(ImGuiStorageHashKey(key) & (ImU32)mask); ; slot = (slot + 1) & mask)
+    {
+        const int idx = storage->HashTable.Data[slot];
+        if (idx == -1 || storage->Data.Data[idx].key == key)
+            return slot;
+    }
+}
+
+static void ImGuiStorageHashRebuild(ImGuiStorage* storage)
+{
+    int capacity = 16;
+    while (capacity < storage->Data.Size * 2 + 2) // Keep load factor under 0.5
+        capacity <<= 1;
+    storage->HashTable.resize(capacity);
+    memset(storage->HashTable.Data, 0xFF, (size_t)storage->HashTable.size_in_bytes());
+    for (int n = 0; n < storage->Data.Size; n++)
+        storage->HashTable.Data[ImGuiStorageHashFindSlot(storage, storage->Data.Data[n].key)] = n;
+}
+
+static ImGuiStoragePair* ImGuiStorageFindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->UseHashTable)
+    {
+        if (storage->HashTable.Size == 0)
+            return NULL;
+        const int idx = storage->HashTable.Data[ImGuiStorageHashFindSlot(storage, key)];
+        return (idx != -1) ? &data[idx] : NULL;
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    if (it == data + storage->Data.Size || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Find pair, insert 'default_pair' if missing.
+static ImGuiStoragePair* ImGuiStorageGetOrAddPair(ImGuiStorage* storage, const ImGuiStoragePair& default_pair)
+{
+    if (storage->UseHashTable)
+    {
+        if ((storage->Data.Size + 1) * 2 > storage->HashTable.Size)
+            ImGuiStorageHashRebuild(storage);
+        int* p_idx = &storage->HashTable.Data[ImGuiStorageHashFindSlot(storage, default_pair.key)];
+        if (*p_idx == -1)
+        {
+            *p_idx = storage->Data.Size;
+            storage->Data.push_back(default_pair);
+        }
+        return &storage->Data.Data[*p_idx];
+    }
+    ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, default_pair.key);
+    if (it == storage->Data.end() || it->key != default_pair.key)
+        it = storage->Data.insert(it, default_pair);
+    return it;
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2556,14 +2871,30 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    if (UseHashTable)
+        ImGuiStorageHashRebuild(this);
+}
+
+void ImGuiStorage::SetUseHashTable(bool enabled)
+{
+    if (UseHashTable == enabled)
+        return;
+    UseHashTable = enabled;
+    if (enabled)
+    {
+        ImGuiStorageHashRebuild(this);
+    }
+    else
+    {
+        HashTable.clear();
+        BuildSortByKey();
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2573,27 +2904,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2603,28 +2927,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2634,20 +2948,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    ImGuiStorageGetOrAddPair(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2657,7 +2963,7 @@ void ImGuiStorage::SetAllInt(int v)
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextFilter
+// [SECTION] ImGuiTextFilter, ImGuiTextFilterIndex
 //-----------------------------------------------------------------------------
 
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
@@ -2753,6 +3059,112 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+static const int TEXTFILTERINDEX_BLOCK_LINES = 16;      // Lines per block
+static const int TEXTFILTERINDEX_BLOCK_WORDS = 64;      // ImU32 per block bitmap (2048 bits)
+
+// Hash a trigram of upper-cased characters to an index in a block bitmap
+static inline ImU32 ImGuiTextFilterIndex_HashTrigram(const char* p)
+{
+    const ImU32 trigram = ((ImU32)(unsigned char)ImToUpper(p[0]) << 16) | ((ImU32)(unsigned char)ImToUpper(p[1]) << 8) | (ImU32)(unsigned char)ImToUpper(p[2]);
+    return (trigram * 2654435761u) >> 21;
+}
+
+void ImGuiTextFilterIndex::Update(const ImGuiTextFilter* filter, const char* buf, const char* buf_end, const int* line_offsets, int lines_count)
+{
+    // Text is only expected to be appended to: if it shrank, filter everything again.
+    const int text_size = (int)(buf_end - buf);
+    if (lines_count < LinesCount || text_size < TextSize)
+        Invalidate();
+    IM_STATIC_ASSERT(sizeof(FilterText) == sizeof(filter->InputBuf));
+    const bool filter_changed = strcmp(FilterText, filter->InputBuf) != 0;
+    if (!filter_changed && lines_count == LinesCount && text_size == TextSize)
+        return;
+    if (filter_changed)
+        memcpy(FilterText, filter->InputBuf, sizeof(FilterText));
+
+    // Last line may have been appended to: index and filter it again
+    const int index_from = ImMax(LinesCount - 1, 0);
+    const int filter_from = filter_changed ? 0 : index_from;
+    LinesCount = lines_count;
+    TextSize = text_size;
+    while (PassingLines.Size > 0 && PassingLines.back() >= filter_from)
+        PassingLines.pop_back();
+
+    // Index trigrams of new lines
+    const int blocks_count = (lines_count + TEXTFILTERINDEX_BLOCK_LINES - 1) / TEXTFILTERINDEX_BLOCK_LINES;
+    const int old_words_count = BlocksTrigrams.Size;
+    BlocksTrigrams.resize(blocks_count * TEXTFILTERINDEX_BLOCK_WORDS);
+    if (BlocksTrigrams.Size > old_words_count)
+        memset(BlocksTrigrams.Data + old_words_count, 0, (size_t)(BlocksTrigrams.Size - old_words_count) * sizeof(ImU32));
+    for (int line_n = index_from; line_n < lines_count; line_n++)
+    {
+        const char* line_begin = buf + line_offsets[line_n];
+        const char* line_end = (line_n + 1 < lines_count) ? buf + line_offsets[line_n + 1] - 1 : buf_end;
+        ImU32* block_bits = &BlocksTrigrams.Data[(line_n / TEXTFILTERINDEX_BLOCK_LINES) * TEXTFILTERINDEX_BLOCK_WORDS];
+        for (const char* p = line_begin; p + 3 <= line_end; p++)
+        {
+            const ImU32 bit_n = ImGuiTextFilterIndex_HashTrigram(p);
+            block_bits[bit_n >> 5] |= (ImU32)1 << (bit_n & 31);
+        }
+    }
+
+    // Filter
+    if (!filter->IsActive())
+    {
+        for (int line_n = filter_from; line_n < lines_count; line_n++)
+            PassingLines.push_back(line_n);
+        return;
+    }
+
+    // Collect trigrams of "grep" filter words. Lines can only pass if they contain one of those words.
+    // If a word is too short to be indexed, we can't skip any block.
+    ImVector<ImU32> words_trigrams; // For each word: trigrams count followed by trigram hashes
+    bool can_skip_blocks = filter->CountGrep > 0;
+    for (const ImGuiTextFilter::ImGuiTextRange& f : filter->Filters)
+    {
+        if (f.empty() || f.b[0] == '-')
+            continue;
+        if (f.e - f.b < 3)
+        {
+            can_skip_blocks = false;
+            break;
+        }
+        words_trigrams.push_back((ImU32)(f.e - f.b - 2));
+        for (const char* p = f.b; p + 3 <= f.e; p++)
+            words_trigrams.push_back(ImGuiTextFilterIndex_HashTrigram(p));
+    }
+
+    for (int block_n = filter_from / TEXTFILTERINDEX_BLOCK_LINES; block_n < blocks_count; block_n++)
+    {
+        if (can_skip_blocks)
+        {
+            const ImU32* block_bits = &BlocksTrigrams.Data[block_n * TEXTFILTERINDEX_BLOCK_WORDS];
+            bool may_pass = false;
+            for (int i = 0; i < words_trigrams.Size && !may_pass; )
+            {
+                const int trigrams_count = (int)words_trigrams[i++];
+                may_pass = true;
+                for (int trigram_n = 0; trigram_n < trigrams_count && may_pass; trigram_n++)
+                {
+                    const ImU32 bit_n = words_trigrams[i + trigram_n];
+                    may_pass = (block_bits[bit_n >> 5] & ((ImU32)1 << (bit_n & 31))) != 0;
+                }
+                i += trigrams_count;
+            }
+            if (!may_pass)
+                continue;
+        }
+        const int line_end_n = ImMin((block_n + 1) * TEXTFILTERINDEX_BLOCK_LINES, lines_count);
+        for (int line_n = ImMax(block_n * TEXTFILTERINDEX_BLOCK_LINES, filter_from); line_n < line_end_n; line_n++)
+        {
+            const char* line_begin = buf + line_offsets[line_n];
+            const char* line_end = (line_n + 1 < lines_count) ? buf + line_offsets[line_n + 1] - 1 : buf_end;
+            if (filter->PassFilter(line_begin, line_end))
+                PassingLines.push_back(line_n);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
@@ -2837,7 +3249,7 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiListClipper
+// [SECTION] ImGuiListClipper, ImGuiListClipperHeights
 //-----------------------------------------------------------------------------
 
 // FIXME-TABLE: This prevents us from using ImGuiListClipper _inside_ a table cell.
@@ -2872,7 +3284,7 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -2891,17 +3303,26 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
 }
 
-static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int item_n)
+// 'item_n_current' is the item following the last submitted or seeked item, only needed with ItemsHeights.
+static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int item_n, int item_n_current)
 {
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+    {
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemOffset(item_n) - heights->GetItemOffset(data->ItemsFrozen));
+        float line_height = (item_n > 0) ? heights->GetItemHeight(item_n - 1) : clipper->ItemsHeight;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, line_height, ImMax(item_n - item_n_current, 0));
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
@@ -2932,6 +3353,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    ItemsHeights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -2944,6 +3366,18 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+// Use ImGuiListClipperHeights to locate items, instead of assuming evenly spaced items.
+// When measuring heights, displayed items are submitted one at a time so we can measure each of them.
+void ImGuiListClipper::BeginWithHeights(ImGuiListClipperHeights* heights, bool measure_heights)
+{
+    const int items_count = heights->GetItemsCount();
+    const double total_height = heights->GetTotalHeight();
+    const float items_height = (items_count > 0 && total_height > 0.0) ? (float)(total_height / items_count) : 1.0f;
+    Begin(items_count, items_height);
+    ItemsHeights = heights;
+    ((ImGuiListClipperData*)TempData)->MeasureHeights = measure_heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -2952,7 +3386,7 @@ void ImGuiListClipper::End()
         ImGuiContext& g = *Ctx;
         IMGUI_DEBUG_LOG_CLIPPER("Clipper: End() in '%s'\n", g.CurrentWindow->Name);
         if (ItemsCount >= 0 && ItemsCount < INT_MAX && DisplayStart >= 0)
-            ImGuiListClipper_SeekCursorForItem(this, ItemsCount);
+            ImGuiListClipper_SeekCursorForItem(this, ItemsCount, DisplayEnd);
 
         // Restore temporary buffer and fix back pointers which may be invalidated when nesting
         IM_ASSERT(data->ListClipper == this);
@@ -2987,6 +3421,16 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Measure height of item submitted by previous step, skipped if affected by floating point precision
+    if (data->MeasureItemN >= 0)
+    {
+        const float height = window->DC.CursorPos.y - data->MeasurePosY;
+        ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+        if (height >= 0.0f && height != heights->GetItemHeight(data->MeasureItemN) && !ImIsFloatAboveGuaranteedIntegerPrecision(data->MeasurePosY) && !ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            heights->SetItemHeight(data->MeasureItemN, height);
+        data->MeasureItemN = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3069,7 +3513,18 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
         for (ImGuiListClipperRange& range : data->Ranges)
-            if (range.PosToIndexConvert)
+            if (range.PosToIndexConvert && clipper->ItemsHeights != NULL)
+            {
+                // Items of varying heights: search offsets relative to the item at cursor position
+                ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+                const double base_offset = heights->GetItemOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+                const int m1 = heights->FindItemAtOffset(base_offset + range.Min);
+                const int m2 = heights->FindItemAtOffset(base_offset + range.Max) + 1;
+                range.Min = ImClamp(m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+                range.Max = ImClamp(m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                range.PosToIndexConvert = false;
+            }
+            else if (range.PosToIndexConvert)
             {
                 int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
                 int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
@@ -3083,11 +3538,23 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
     while (data->StepNo < data->Ranges.Size)
     {
+        const int item_n_current = clipper->DisplayEnd;
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
         if (clipper->DisplayStart > already_submitted) //-V1051
-            ImGuiListClipper_SeekCursorForItem(clipper, clipper->DisplayStart);
+            ImGuiListClipper_SeekCursorForItem(clipper, clipper->DisplayStart, item_n_current);
+        if (data->MeasureHeights && clipper->DisplayEnd - clipper->DisplayStart > 1)
+        {
+            // Measuring heights: display one item, the rest of the range is displayed by next step
+            data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+        }
         data->StepNo++;
+        if (data->MeasureHeights && clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            data->MeasureItemN = clipper->DisplayStart;
+            data->MeasurePosY = window->DC.CursorPos.y;
+        }
         if (clipper->DisplayStart == clipper->DisplayEnd && data->StepNo < data->Ranges.Size)
             continue;
         return true;
@@ -3096,7 +3563,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     // After the last step: Let the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd),
     // Advance the cursor to the end of the list and then returns 'false' to end the loop.
     if (clipper->ItemsCount < INT_MAX)
-        ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount);
+        ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount, clipper->DisplayEnd);
 
     return false;
 }
@@ -3124,6 +3591,77 @@ bool ImGuiListClipper::Step()
     return ret;
 }
 
+// Fenwick tree indices are 1-based: Tree[n] stores the sum of heights of the (n & -n) items ending with item n - 1.
+void ImGuiListClipperHeights::Build(int items_count, ImGuiListClipperHeightFunc height_func, void* user_data)
+{
+    IM_ASSERT(items_count >= 0);
+    Heights.resize(items_count);
+    Tree.resize(items_count > 0 ? items_count + 1 : 0);
+    for (int item_n = 0; item_n < items_count; item_n++)
+        Tree.Data[item_n + 1] = Heights.Data[item_n] = height_func(user_data, item_n);
+    for (int n = 1; n <= items_count; n++)
+    {
+        const int parent_n = n + (n & -n);
+        if (parent_n <= items_count)
+            Tree.Data[parent_n] += Tree.Data[n];
+    }
+}
+
+void ImGuiListClipperHeights::Resize(int items_count, float new_items_height)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_items_count = Heights.Size;
+    Heights.resize(items_count);
+    Tree.resize(items_count > 0 ? items_count + 1 : 0);
+
+    // Append items: children of a new node are existing nodes (n - 1), (n - 2), (n - 4)... (n - (n & -n) / 2)
+    for (int n = old_items_count + 1; n <= items_count; n++)
+    {
+        Heights.Data[n - 1] = new_items_height;
+        double sum = new_items_height;
+        for (int child_step = 1; child_step < (n & -n); child_step <<= 1)
+            sum += Tree.Data[n - child_step];
+        Tree.Data[n] = sum;
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)height - (double)Heights.Data[item_n];
+    Heights.Data[item_n] = height;
+    for (int n = item_n + 1; n <= Heights.Size; n += (n & -n))
+        Tree.Data[n] += delta;
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double offset = 0.0;
+    for (int n = item_n; n > 0; n -= (n & -n))
+        offset += Tree.Data[n];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the tree to find last item with GetItemOffset(n) <= offset
+    const int items_count = Heights.Size;
+    if (items_count == 0 || offset <= 0.0)
+        return 0;
+    int n = 0;
+    int step = 1;
+    while (step * 2 <= items_count)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (n + step <= items_count && Tree.Data[n + step] <= offset)
+        {
+            n += step;
+            offset -= Tree.Data[n];
+        }
+    return ImMin(n, items_count - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3383,6 +3921,118 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
     return text_display_end;
 }
 
+// Text layout cache (see io.ConfigTextLayoutCache)
+// Return NULL if this text is not cached. Returned entry may need its size/glyphs to be calculated.
+// - Entries are looked up in g.TextLayoutCacheMap, then compared with font, size, wrap width and contents to rule out hash collisions.
+// - Glyphs of fonts using ImFontAtlasFlags_DynamicGlyphs change when loaded or evicted: entries of another glyphs generation are reinitialized.
+// - Large text is not cached, as copying and comparing it would cost about as much as measuring it.
+static ImGuiTextLayout* TextLayoutCacheGet(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    if (text_len > 2048)
+        return NULL;
+    const int glyphs_generation = ImFontGetGlyphsGeneration(font);
+
+    // Fast path: same text as last lookup (typically CalcTextSize() followed by RenderText())
+    if (g.TextLayoutCacheLastIdx != -1)
+    {
+        ImGuiTextLayout* layout = &g.TextLayoutCache[g.TextLayoutCacheLastIdx];
+        if (layout->Font == font && layout->FontSize == font_size && layout->WrapWidth == wrap_width && layout->FontGlyphs == font->Glyphs.Data && layout->FontGlyphsGeneration == glyphs_generation && layout->Text.Size == text_len && memcmp(layout->Text.Data, text, (size_t)text_len) == 0)
+        {
+            layout->LastFrameUsed = g.FrameCount;
+            return layout;
+        }
+    }
+
+    // Mix font, size and wrap width into the seed: a colliding key only makes entries share a slot
+    const ImGuiID seed = (ImGuiID)(size_t)font ^ ((ImGuiID)(font_size * 64.0f) << 20) ^ (ImGuiID)(wrap_width * 16.0f);
+    const ImGuiID key = ImHashDataFast(text, (size_t)text_len, seed);
+    int* p_idx = g.TextLayoutCacheMap.GetIntRef(key, -1);
+    if (*p_idx == -1)
+    {
+        *p_idx = g.TextLayoutCache.Size;
+        g.TextLayoutCache.push_back(ImGuiTextLayout());
+    }
+    const int idx = *p_idx;
+    ImGuiTextLayout* layout = &g.TextLayoutCache[idx];
+    if (layout->Key != key || layout->Font != font || layout->FontSize != font_size || layout->WrapWidth != wrap_width || layout->FontGlyphs != font->Glyphs.Data || layout->FontGlyphsGeneration != glyphs_generation || layout->Text.Size != text_len || memcmp(layout->Text.Data, text, (size_t)text_len) != 0)
+    {
+        // New entry, glyphs changed or colliding with a different text: (re)initialize
+        layout->Key = key;
+        layout->Font = font;
+        layout->FontSize = font_size;
+        layout->WrapWidth = wrap_width;
+        layout->FontGlyphs = font->Glyphs.Data;
+        layout->FontGlyphsGeneration = glyphs_generation;
+        layout->Text.resize(text_len);
+        memcpy(layout->Text.Data, text, (size_t)text_len);
+        layout->HasSize = layout->HasGlyphs = false;
+    }
+    layout->LastFrameUsed = g.FrameCount;
+    g.TextLayoutCacheLastIdx = idx;
+    return layout;
+}
+
+// Called by NewFrame(): discard all entries when disabled, and entries not used during the last frames.
+static void TextLayoutCacheUpdate()
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiTextLayout>& cache = g.TextLayoutCache;
+    const int UNUSED_FRAMES_BEFORE_DISCARD = 30;
+    g.TextLayoutCacheLastIdx = -1;
+    if (!g.IO.ConfigTextLayoutCache)
+    {
+        if (cache.Capacity > 0)
+        {
+            cache.clear_destruct();
+            g.TextLayoutCacheMap.Clear();
+        }
+        return;
+    }
+    if ((g.FrameCount % UNUSED_FRAMES_BEFORE_DISCARD) != 0)
+        return;
+
+    // Compact entries in place, then rebuild the map (text being modified every frame would otherwise keep adding new keys)
+    int alive_count = 0;
+    for (int n = 0; n < cache.Size; n++)
+    {
+        if (cache[n].LastFrameUsed < g.FrameCount - UNUSED_FRAMES_BEFORE_DISCARD)
+            cache[n].~ImGuiTextLayout();
+        else if (alive_count++ != n)
+            memcpy((void*)&cache[alive_count - 1], (const void*)&cache[n], sizeof(ImGuiTextLayout));
+    }
+    cache.shrink(alive_count);
+    ImGuiStorage& map = g.TextLayoutCacheMap;
+    map.Data.resize(0);
+    for (int n = 0; n < cache.Size; n++)
+        map.Data.push_back(ImGuiStoragePair(cache[n].Key, n));
+    map.BuildSortByKey();
+}
+
+// Render text using text layout cache if possible, otherwise ImDrawList::AddText()
+static void RenderTextWithLayoutCache(ImDrawList* draw_list, ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.IO.ConfigTextLayoutCache && text_end != NULL && text != text_end && text[0] != 0)
+        if (ImGuiTextLayout* layout = TextLayoutCacheGet(font, font_size, wrap_width, text, text_end))
+        {
+            if (layout->HasGlyphs)
+            {
+                g.TextLayoutCacheHitCount++;
+            }
+            else
+            {
+                ImFontCalcTextLayout(font, font_size, wrap_width, text, text_end, &layout->Glyphs);
+                layout->HasGlyphs = true;
+                g.TextLayoutCacheMissCount++;
+            }
+            ImFontRenderTextLayout(font, draw_list, font_size, pos, col, layout);
+            return;
+        }
+    draw_list->AddText(font, font_size, pos, col, text, text_end, wrap_width);
+}
+
 // Internal ImGui functions to render text
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
@@ -3405,7 +4055,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
     if (text != text_display_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
+        RenderTextWithLayoutCache(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_display_end);
     }
@@ -3421,7 +4071,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        RenderTextWithLayoutCache(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -3456,7 +4106,7 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     }
     else
     {
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
+        RenderTextWithLayoutCache(draw_list, draw_list->_Data->Font, draw_list->_Data->FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f);
     }
 }
 
@@ -3721,6 +4371,7 @@ void ImGui::Initialize()
     viewport->ID = IMGUI_VIEWPORT_DEFAULT_ID;
     g.Viewports.push_back(viewport);
     g.TempBuffer.resize(1024 * 3 + 1, 0);
+    g.TextLayoutCacheMap.SetUseHashTable(true);
 
     // Build KeysMayBeCharInput[] lookup table (1 bool per named key)
     for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key = (ImGuiKey)(key + 1))
@@ -3750,7 +4401,6 @@ void ImGui::Shutdown()
         IM_DELETE(g.IO.Fonts);
     }
     g.IO.Fonts = NULL;
-    g.DrawListSharedData.TempBuffer.clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -3766,6 +4416,7 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsHoverGrid.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -3790,10 +4441,14 @@ void ImGui::Shutdown()
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    g.ClipGroups.Clear();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
+    g.TextLayoutCache.clear_destruct();
+    g.TextLayoutCacheMap.Clear();
+    g.TextLayoutCacheLastIdx = -1;
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
@@ -3814,6 +4469,7 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    g.FrameArena.Clear();
 
     g.Initialized = false;
 }
@@ -3904,6 +4560,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.FrameArena.Clear();
     TableGcCompactSettings();
 }
 
@@ -4159,10 +4816,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestRefreshEx(ImMax(g.Style.HoverStationaryDelay - g.MouseStationaryTimer, delay - g.HoverItemDelayTimer), "Hover delay");
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestRefreshEx(delay - g.HoverItemDelayTimer, "Hover delay");
             return false;
+        }
     }
 
     return true;
@@ -4321,6 +4984,82 @@ void ImGui::MemFree(void* ptr)
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Frame-lifetime allocation, released all at once by the next NewFrame()
+// Prefer this to MemAlloc()/MemFree() pairs for temporary buffers used within a frame.
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    g.DebugAllocInfo.TotalFrameAllocCount++;
+    return g.FrameArena.Alloc(size);
+}
+
+static const size_t ImArenaAllocator_MinBlockSize = 16 * 1024;
+
+void* ImArenaAllocator::Alloc(size_t size)
+{
+    IM_ASSERT(size <= ((size_t)-1) / 4 && "Allocation too large!");
+    size = IM_MEMALIGN(size, 16);
+    if (Blocks.Size == 0 || CurrBlockOffset + size > CurrBlockSize)
+    {
+        // Allocate overflow block. Next Reset() will merge all blocks into one.
+        const size_t block_size = ImMax(size, ImMax(MainBlockSize, ImArenaAllocator_MinBlockSize));
+        Blocks.push_back(IM_ALLOC(block_size));
+        if (Blocks.Size == 1)
+            MainBlockSize = block_size;
+        CurrBlockSize = block_size;
+        CurrBlockOffset = 0;
+        ReservedBytes += block_size;
+    }
+    void* ptr = (char*)Blocks.back() + CurrBlockOffset;
+    CurrBlockOffset += size;
+    UsedBytes += size;
+    UsedCount++;
+    return ptr;
+}
+
+void ImArenaAllocator::Reset()
+{
+    PeakUsedBytes = ImMax(PeakUsedBytes, UsedBytes);
+    RecentPeakUsedBytes = ImMax(RecentPeakUsedBytes, UsedBytes);
+    RecentResetCount++;
+
+    // Replace all blocks with a single one which would have fit everything,
+    // or shrink main block when it was much larger than needed for a while.
+    size_t needed_size = 0;
+    if (Blocks.Size > 1)
+        needed_size = UsedBytes;
+    else if (Blocks.Size == 1 && RecentResetCount >= DecayResetCount && MainBlockSize > ImArenaAllocator_MinBlockSize && RecentPeakUsedBytes * 4 <= MainBlockSize)
+        needed_size = RecentPeakUsedBytes;
+    if (needed_size > 0)
+    {
+        IM_ASSERT(needed_size <= ((size_t)-1) / 2);
+        size_t new_block_size = ImArenaAllocator_MinBlockSize;
+        while (new_block_size < needed_size)
+            new_block_size *= 2;
+        Clear();
+        Blocks.push_back(IM_ALLOC(new_block_size));
+        MainBlockSize = CurrBlockSize = ReservedBytes = new_block_size;
+    }
+    if (needed_size > 0 || RecentResetCount >= DecayResetCount)
+    {
+        RecentPeakUsedBytes = 0;
+        RecentResetCount = 0;
+    }
+    CurrBlockOffset = 0;
+    UsedBytes = 0;
+    UsedCount = 0;
+}
+
+void ImArenaAllocator::Clear()
+{
+    for (void* block : Blocks)
+        IM_FREE(block);
+    Blocks.clear();
+    MainBlockSize = CurrBlockSize = CurrBlockOffset = ReservedBytes = 0;
+    UsedBytes = 0;
+    UsedCount = 0;
+}
+
 // We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
 void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
 {
@@ -4389,6 +5128,84 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+// [BETA] Request a new frame within 'delay' seconds. Output to io.WantRefresh/io.RefreshTimeout for applications which idle between frames.
+void ImGui::RequestRefresh(float delay)
+{
+    RequestRefreshEx(delay, "RequestRefresh()");
+}
+
+void ImGui::RequestRefreshEx(float delay, const char* reason)
+{
+    ImGuiContext& g = *GImGui;
+    delay = ImMax(delay, 0.0f);
+    if (delay >= g.RefreshDelay)
+        return;
+    g.RefreshDelay = delay;
+    g.RefreshReason = reason;
+
+    // Requests made after EndFrame() (e.g. from Render() or between frames) update outputs directly
+    if (g.FrameCountEnded == g.FrameCount)
+    {
+        g.IO.RefreshTimeout = delay;
+        g.IO.WantRefresh = (delay <= 0.0f);
+    }
+}
+
+// Called by EndFrame(). Gather reasons for next frame to differ from this one even without new input events.
+// Timed changes (e.g. hover delays, blinking text cursor) are requested with RequestRefreshEx() where they are handled.
+// FIXME-IDLE: Changes driven by user code (e.g. reading GetTime()) need user to call RequestRefresh().
+void ImGui::UpdateRefreshEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    if (g.RefreshSettleFrames > 0)
+        RequestRefreshEx(0.0f, "Input events");
+    if (g.InputEventsQueue.Size > 0)
+        RequestRefreshEx(0.0f, "Queued input events");
+    if (io.DisplaySize.x != g.RefreshDisplaySizePrev.x || io.DisplaySize.y != g.RefreshDisplaySizePrev.y)
+        RequestRefreshEx(0.0f, "DisplaySize changed");
+    g.RefreshDisplaySizePrev = io.DisplaySize;
+
+    // Held buttons and keys (repeat, drag, window move/resize)
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown); n++)
+        if (io.MouseDown[n])
+            RequestRefreshEx(0.0f, "Mouse button held");
+    if (g.RefreshDelay > 0.0f)
+        for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key = (ImGuiKey)(key + 1))
+            if ((IsKeyboardKey(key) || IsGamepadKey(key)) && !IsModKey(key) && GetKeyData(key)->Down)
+            {
+                RequestRefreshEx(0.0f, "Key held");
+                break;
+            }
+
+    // Animations and requests processed on next frame
+    const bool dim_bg_target = GetTopMostPopupModal() != NULL || (g.NavWindowingTarget != NULL && g.NavWindowingHighlightAlpha > 0.0f);
+    if (dim_bg_target ? (g.DimBgRatio < 1.0f) : (g.DimBgRatio > 0.0f))
+        RequestRefreshEx(0.0f, "Dimming background");
+    if (g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f)
+        RequestRefreshEx(0.0f, "Nav windowing");
+    if (g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0)
+        RequestRefreshEx(0.0f, "Nav request");
+    if (g.DragDropActive)
+        RequestRefreshEx(0.0f, "Drag and drop");
+    if (ImFontAtlasHasDynamicGlyphRequests(io.Fonts))
+        RequestRefreshEx(0.0f, "Dynamic glyphs");
+    if (g.SettingsDirtyTimer > 0.0f)
+        RequestRefreshEx(g.SettingsDirtyTimer, "Saving settings");
+
+    // Windows which are appearing, auto-fitting or scrolling to a target
+    if (g.RefreshDelay > 0.0f)
+        for (ImGuiWindow* window : g.Windows)
+            if (window->Active && (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX))
+            {
+                RequestRefreshEx(0.0f, "Window layout");
+                break;
+            }
+
+    io.RefreshTimeout = g.RefreshDelay;
+    io.WantRefresh = (g.RefreshDelay <= 0.0f);
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4655,7 +5472,7 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
-    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
+    if (g.IO.BackendFlags & (ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32)) // With RendererHasIdx32 only, draw lists using VtxOffset are converted by Render()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
 }
 
@@ -4681,6 +5498,7 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.FrameArena.Reset();
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4696,11 +5514,21 @@ void ImGui::NewFrame()
     g.InputEventsTrail.resize(0);
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
 
+    // Reset refresh requests (see UpdateRefreshEndFrame())
+    g.RefreshDelay = FLT_MAX;
+    if (g.InputEventsTrail.Size > 0)
+        g.RefreshSettleFrames = 2;
+    else if (g.RefreshSettleFrames > 0)
+        g.RefreshSettleFrames--;
+
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
+    if (g.IO.Fonts->DynamicGlyphs != NULL && !g.IO.Fonts->Locked)
+        ImFontAtlasUpdateDynamicGlyphs(g.IO.Fonts);
     g.IO.Fonts->Locked = true;
+    TextLayoutCacheUpdate();
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
@@ -5192,6 +6020,8 @@ void ImGui::EndFrame()
 
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
+    if (memcmp(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.size_in_bytes()) != 0)
+        g.WindowsHoverGrid.Invalidate(); // Grid stores indices into g.Windows[]
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
@@ -5204,6 +6034,9 @@ void ImGui::EndFrame()
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
 
+    // Tell application if next frame is needed (may be updated again by Render())
+    UpdateRefreshEndFrame();
+
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -5266,8 +6099,44 @@ void ImGui::Render()
         // We call _PopUnusedDrawCmd() last thing, as RenderDimmedBackgrounds() rely on a valid command being there (especially in docking branch).
         ImDrawData* draw_data = &viewport->DrawDataP;
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
+        int cmd_count = 0;
         for (ImDrawList* draw_list : draw_data->CmdLists)
+        {
             draw_list->_PopUnusedDrawCmd();
+            cmd_count += draw_list->CmdBuffer.Size;
+        }
+        viewport->DrawDataListCountBeforeMerge = draw_data->CmdListsCount;
+        viewport->DrawDataCmdCountBeforeMerge = viewport->DrawDataCmdCount = cmd_count;
+
+        // Merge draw lists to reduce draw calls (without renderer support for VtxOffset or 32-bit indices we can only merge up to 64K vertices with 16-bit indices)
+        const bool can_merge = (sizeof(ImDrawIdx) == 4 || (g.IO.BackendFlags & (ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32)) || draw_data->TotalVtxCount <= (1 << 16));
+        if (g.IO.ConfigMergeDrawLists && can_merge && draw_data->CmdListsCount > 0)
+        {
+            if (viewport->DrawDataMergedList == NULL)
+            {
+                viewport->DrawDataMergedList = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+                viewport->DrawDataMergedList->_OwnerName = "##MergedDrawLists";
+            }
+            draw_data->MergeDrawLists(viewport->DrawDataMergedList);
+            viewport->DrawDataCmdCount = viewport->DrawDataMergedList->CmdBuffer.Size;
+        }
+        else if (!g.IO.ConfigMergeDrawLists && viewport->DrawDataMergedList != NULL)
+        {
+            IM_DELETE(viewport->DrawDataMergedList);
+            viewport->DrawDataMergedList = NULL;
+        }
+
+        // Convert draw lists which were split every 64K vertices to 32-bit indices, so each of their commands is a single draw call
+        if (sizeof(ImDrawIdx) == 2 && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdx32))
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                if (draw_list->CmdBuffer.Size > 0 && draw_list->CmdBuffer.back().VtxOffset != 0)
+                {
+                    const int cmd_count_before_convert = draw_list->CmdBuffer.Size;
+                    const int idx_count_before_convert = draw_list->IdxBuffer.Size;
+                    draw_list->ConvertIdxBufferTo32();
+                    viewport->DrawDataCmdCount -= cmd_count_before_convert - draw_list->CmdBuffer.Size;
+                    draw_data->TotalIdxCount -= idx_count_before_convert - draw_list->IdxBuffer32.Size;
+                }
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
@@ -5292,7 +6161,30 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    ImVec2 text_size;
+    ImGuiTextLayout* layout = NULL;
+    if (g.IO.ConfigTextLayoutCache)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        layout = TextLayoutCacheGet(font, font_size, wrap_width, text, text_display_end);
+    }
+    if (layout && layout->HasSize)
+    {
+        text_size = layout->Size;
+        g.TextLayoutCacheHitCount++;
+    }
+    else
+    {
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+        if (layout)
+        {
+            layout->Size = text_size;
+            layout->HasSize = true;
+            g.TextLayoutCacheMissCount++;
+        }
+    }
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -5321,9 +6213,26 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+
+    // Only test windows from the grid cell containing 'pos'.
+    // Grid is built on second search since windows last moved/appeared/reordered (typically second frame of a still layout).
+    ImGuiWindowHoverGrid* grid = &g.WindowsHoverGrid;
+    const int* candidates = NULL;
+    int candidates_count = g.Windows.Size;
+    if (grid->Valid && (grid->PaddingRegular != padding_regular || grid->PaddingForResize != padding_for_resize))
+        grid->Invalidate();
+    if (g.IO.ConfigWindowsHoverGrid && !grid->Valid && g.Windows.Size >= WINDOWS_HOVER_GRID_MIN_COUNT && ++grid->SearchCount >= 2)
+        UpdateWindowsHoverGrid(padding_regular, padding_for_resize);
+    if (g.IO.ConfigWindowsHoverGrid && grid->Valid)
     {
-        ImGuiWindow* window = g.Windows[i];
+        const int cell_n = grid->GetCellY(pos.y) * grid->CellsX + grid->GetCellX(pos.x);
+        candidates = grid->CellWindows.Data + grid->CellOffsets[cell_n];
+        candidates_count = grid->CellOffsets[cell_n + 1] - grid->CellOffsets[cell_n];
+    }
+
+    for (int candidate_n = 0; candidate_n < candidates_count; candidate_n++)
+    {
+        ImGuiWindow* window = g.Windows[candidates ? candidates[candidate_n] : g.Windows.Size - 1 - candidate_n];
         IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
         if (!window->Active || window->Hidden)
             continue;
@@ -5367,6 +6276,89 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
         *out_hovered_window_under_moving_window = hovered_window_under_moving_window;
 }
 
+// Called by FindHoveredWindowEx(). Build uniform grid over hoverable windows.
+// Windows are inserted in every cell overlapped by their OuterRectClipped expanded by hit-test padding, front to back,
+// so searching one cell gives the same result as searching all windows.
+// Windows submitted last frame are included even if not submitted yet this frame: FindHoveredWindowEx() tests Active/Hidden itself,
+// so Begin() only needs to invalidate the grid when a window appears, moves or changes hit-test flags.
+static void ImGui::UpdateWindowsHoverGrid(const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHoverGrid* grid = &g.WindowsHoverGrid;
+
+    // Gather windows which may be hoverable until next invalidation
+    grid->PaddingRegular = padding_regular;
+    grid->PaddingForResize = padding_for_resize;
+    grid->TempRects.resize(g.Windows.Size);
+    grid->TempIndices.resize(g.Windows.Size);
+    ImRect* rects = grid->TempRects.Data;
+    int* rects_window_idx = grid->TempIndices.Data;
+    int rects_count = 0;
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    {
+        ImGuiWindow* window = g.Windows.Data[i];
+        if (window->LastFrameActive < g.FrameCount - 1 || (window->Flags & ImGuiWindowFlags_NoMouseInputs))
+            continue;
+        const ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? grid->PaddingRegular : grid->PaddingForResize;
+        const ImRect rect(window->OuterRectClipped.Min - hit_padding, window->OuterRectClipped.Max + hit_padding);
+        if (!(rect.Min.x < rect.Max.x && rect.Min.y < rect.Max.y)) // Can't contain any point
+            continue;
+        rects[rects_count] = rect;
+        rects_window_idx[rects_count] = i;
+        rects_count++;
+        bounds.Add(rect);
+    }
+
+    // Aim for a few windows per cell: smaller cells would make large windows overlap many cells
+    if (rects_count > 0)
+    {
+        const ImVec2 bounds_size = bounds.GetSize();
+        const float cells_target = (float)rects_count / 4.0f;
+        const float cells_x = ImSqrt(cells_target * bounds_size.x / bounds_size.y);
+        grid->CellsX = ImClamp((int)cells_x, 1, 256);
+        grid->CellsY = ImClamp((int)(cells_target / ImMax(cells_x, 1.0f)), 1, 256);
+        grid->Origin = bounds.Min;
+        grid->CellInvSize = ImVec2((float)grid->CellsX / bounds_size.x, (float)grid->CellsY / bounds_size.y);
+    }
+    else
+    {
+        grid->CellsX = grid->CellsY = 1;
+        grid->Origin = grid->CellInvSize = ImVec2(0.0f, 0.0f);
+    }
+
+    // Count windows per cell, then fill cells (counting sort, keeps front to back order within each cell)
+    const int cells_count = grid->CellsX * grid->CellsY;
+    grid->CellOffsets.resize(cells_count + 1);
+    int* offsets = grid->CellOffsets.Data;
+    memset(offsets, 0, (size_t)grid->CellOffsets.size_in_bytes());
+    for (int rect_n = 0; rect_n < rects_count; rect_n++)
+    {
+        const int x0 = grid->GetCellX(rects[rect_n].Min.x), x1 = grid->GetCellX(rects[rect_n].Max.x);
+        const int y0 = grid->GetCellY(rects[rect_n].Min.y), y1 = grid->GetCellY(rects[rect_n].Max.y);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                offsets[y * grid->CellsX + x + 1]++;
+    }
+    for (int cell_n = 0; cell_n < cells_count; cell_n++)
+        offsets[cell_n + 1] += offsets[cell_n];
+    grid->CellWindows.resize(offsets[cells_count]);
+    int* cell_windows = grid->CellWindows.Data;
+    for (int rect_n = 0; rect_n < rects_count; rect_n++)
+    {
+        const int x0 = grid->GetCellX(rects[rect_n].Min.x), x1 = grid->GetCellX(rects[rect_n].Max.x);
+        const int y0 = grid->GetCellY(rects[rect_n].Min.y), y1 = grid->GetCellY(rects[rect_n].Max.y);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                cell_windows[offsets[y * grid->CellsX + x]++] = rects_window_idx[rect_n];
+    }
+    for (int cell_n = cells_count; cell_n > 0; cell_n--) // Fill pass advanced each offset to the start of next cell
+        offsets[cell_n] = offsets[cell_n - 1];
+    offsets[0] = 0;
+    grid->Valid = true;
+    grid->SearchCount = 0;
+}
+
 bool ImGui::IsItemActive()
 {
     ImGuiContext& g = *GImGui;
@@ -5783,6 +6775,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsHoverGrid.Invalidate();
 
     return window;
 }
@@ -6562,6 +7555,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (first_begin_of_the_frame)
     {
         UpdateWindowInFocusOrderList(window, window_just_created, flags);
+        if (window->LastFrameActive < current_frame - 1 || ((window->Flags ^ flags) & (ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)))
+            g.WindowsHoverGrid.Invalidate(); // Window may be missing from grid or hit-test padding changed
         window->Flags = (ImGuiWindowFlags)flags;
         window->ChildFlags = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasChildFlags) ? g.NextWindowData.ChildFlags : 0;
         window->LastFrameActive = current_frame;
@@ -6973,8 +7968,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect host_rect = ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip) ? parent_window->ClipRect : viewport_rect;
         const ImRect outer_rect = window->Rect();
         const ImRect title_bar_rect = window->TitleBarRect();
+        const ImRect outer_rect_clipped_prev = window->OuterRectClipped;
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        if (window->OuterRectClipped.Min != outer_rect_clipped_prev.Min || window->OuterRectClipped.Max != outer_rect_clipped_prev.Max)
+            g.WindowsHoverGrid.Invalidate();
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -7350,6 +8348,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsHoverGrid.Invalidate();
             break;
         }
 }
@@ -7364,6 +8363,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsHoverGrid.Invalidate();
             break;
         }
 }
@@ -7388,6 +8388,7 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
     }
+    g.WindowsHoverGrid.Invalidate();
 }
 
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
@@ -9941,6 +10942,7 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((g.IO.Fonts->DynamicGlyphs == NULL || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontAtlasFlags_DynamicGlyphs needs a renderer backend uploading ImFontAtlas::TexDirtyRect, which sets ImGuiBackendFlags_RendererHasTexUpdates!");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -10604,6 +11606,7 @@ void ImGui::BeginGroup()
     group_data.BackupIsSameLine = window->DC.IsSameLine;
     group_data.BackupActiveIdPreviousFrameIsAlive = g.ActiveIdPreviousFrameIsAlive;
     group_data.EmitItem = true;
+    group_data.ClipGroupID = 0;
 
     window->DC.GroupOffset.x = window->DC.CursorPos.x - window->Pos.x - window->DC.ColumnsOffset.x;
     window->DC.Indent = window->DC.GroupOffset;
@@ -10679,6 +11682,67 @@ void ImGui::EndGroup()
         window->DrawList->AddRect(group_bb.Min, group_bb.Max, IM_COL32(255,0,255,255));   // [Debug]
 }
 
+// Clip groups: skip submitting a whole group of items when it is fully outside of the visible area.
+// - Rectangle is given by 'size', components <= 0.0f using the size measured last time the group was submitted.
+//   On first submission, or when both are unknown, the group is always submitted.
+// - When skipped, layout advances by 'size' as if EndGroup() had been called, in O(1).
+// - Never skipped while logging, while a navigation request is scoring items of this window, or when the group contains
+//   the focused item (according to its last known position) or the active item.
+bool ImGui::BeginClipGroup(const char* str_id, const ImVec2& size)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    return BeginClipGroupEx(window->GetID(str_id), size);
+}
+
+bool ImGui::BeginClipGroupEx(ImGuiID id, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return false;
+
+    ImGuiClipGroupData* clip_group = g.ClipGroups.GetOrAddByKey(id);
+    clip_group->ID = id;
+    const ImVec2 size(size_arg.x > 0.0f ? size_arg.x : clip_group->Size.x, size_arg.y > 0.0f ? size_arg.y : clip_group->Size.y);
+    if (size.x >= 0.0f && size.y >= 0.0f && !g.LogEnabled)
+    {
+        const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + size);
+        bool skip = !bb.Overlaps(window->ClipRect);
+        if (skip && (g.NavMoveScoringItems || g.NavInitRequest) && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav)
+            skip = false; // Navigation request may land in group, or needs items beyond clipping rectangle to scroll
+        if (skip && g.NavId != 0 && window->NavLastIds[0] == g.NavId && bb.Overlaps(WindowRectRelToAbs(window, window->NavRectRel[0])))
+            skip = false;
+        if (skip && clip_group->ActiveId != 0 && (clip_group->ActiveId == g.ActiveId || clip_group->ActiveId == g.ActiveIdPreviousFrame))
+            skip = false;
+        if (skip)
+        {
+            window->DC.CurrLineTextBaseOffset = ImMax(window->DC.CurrLineTextBaseOffset, clip_group->TextBaseOffset);
+            ItemSize(size);
+            ItemAdd(bb, 0, NULL, ImGuiItemFlags_NoTabStop);
+            g.ClipGroupsSkipCount++;
+            return false;
+        }
+    }
+
+    BeginGroup();
+    g.GroupStack.back().ClipGroupID = id;
+    return true;
+}
+
+void ImGui::EndClipGroup()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(g.GroupStack.Size > 0 && g.GroupStack.back().ClipGroupID != 0); // Mismatched BeginClipGroup()/EndClipGroup() calls. Only call EndClipGroup() if BeginClipGroup() returned true!
+
+    ImGuiClipGroupData* clip_group = g.ClipGroups.GetByKey(g.GroupStack.back().ClipGroupID);
+    const float text_base_offset = window->DC.PrevLineTextBaseOffset;
+    EndGroup();
+    clip_group->Size = g.LastItemData.Rect.GetSize();
+    clip_group->TextBaseOffset = text_base_offset;
+    clip_group->ActiveId = g.LastItemData.ID; // Set by EndGroup() if the group contains current or previous frame's active item
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] SCROLLING
@@ -14607,6 +15671,23 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    {
+        int draw_list_count = 0, cmd_count_before_merge = 0, cmd_count = 0;
+        for (ImGuiViewportP* viewport : g.Viewports)
+        {
+            draw_list_count += viewport->DrawDataListCountBeforeMerge;
+            cmd_count_before_merge += viewport->DrawDataCmdCountBeforeMerge;
+            cmd_count += viewport->DrawDataCmdCount;
+        }
+        if (cmd_count != cmd_count_before_merge)
+            Text("%d draw calls, merged from %d draw calls in %d draw lists (%.1fx fewer)", cmd_count, cmd_count_before_merge, draw_list_count, cmd_count > 0 ? (float)cmd_count_before_merge / cmd_count : 0.0f);
+        else
+            Text("%d draw calls in %d draw lists", cmd_count, draw_list_count);
+    }
+    if (g.TextLayoutCacheHitCount + g.TextLayoutCacheMissCount > 0)
+        Text("Text layout cache: %d entries, %d hits, %d misses (%.1f%% hit rate)", g.TextLayoutCache.Size, g.TextLayoutCacheHitCount, g.TextLayoutCacheMissCount, g.TextLayoutCacheHitCount * 100.0f / (g.TextLayoutCacheHitCount + g.TextLayoutCacheMissCount));
+    if (g.ClipGroups.GetAliveCount() > 0)
+        Text("Clip groups: %d, %d skipped", g.ClipGroups.GetAliveCount(), g.ClipGroupsSkipCount);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -14936,7 +16017,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     if (TreeNode("Memory allocations"))
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+        ImArenaAllocator* arena = &g.FrameArena;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
+        Text("Frame arena: %d allocations, %" IM_PRIu64 " bytes this frame (peak %" IM_PRIu64 " bytes), %" IM_PRIu64 " bytes in %d blocks", arena->UsedCount, (ImU64)arena->UsedBytes, (ImU64)ImMax(arena->PeakUsedBytes, arena->UsedBytes), (ImU64)arena->ReservedBytes, arena->Blocks.Size);
+        Text("Frame arena: %d allocations total", info->TotalFrameAllocCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
@@ -15053,6 +16137,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("HoveredWindow->Root: '%s'", g.HoveredWindow ? g.HoveredWindow->RootWindow->Name : "NULL");
         Text("HoveredWindowUnderMovingWindow: '%s'", g.HoveredWindowUnderMovingWindow ? g.HoveredWindowUnderMovingWindow->Name : "NULL");
         Text("MovingWindow: '%s'", g.MovingWindow ? g.MovingWindow->Name : "NULL");
+        Text("WindowsHoverGrid: %dx%d cells, %d entries", g.WindowsHoverGrid.CellsX, g.WindowsHoverGrid.CellsY, g.WindowsHoverGrid.CellWindows.Size);
         Unindent();
 
         Text("ITEMS");
@@ -15090,6 +16175,12 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         Unindent();
 
+        Text("IDLING");
+        Indent();
+        Text("io.WantRefresh: %d, io.RefreshTimeout: %.2f", g.IO.WantRefresh, (g.IO.RefreshTimeout == FLT_MAX) ? -1.0f : g.IO.RefreshTimeout);
+        Text("RefreshReason: %s", g.RefreshReason ? g.RefreshReason : "NULL");
+        Unindent();
+
         TreePop();
     }
 
@@ -15242,7 +16333,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices%s, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size + draw_list->IdxBuffer32.Size, draw_list->IdxBuffer32.Size > 0 ? " (32-bit)" : "", cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -15283,13 +16374,14 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+        const ImU32* idx_buffer32 = (draw_list->IdxBuffer32.Size > 0) ? draw_list->IdxBuffer32.Data : NULL;
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
         float total_area = 0.0f;
         for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_n] : idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -15309,7 +16401,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImDrawVert& v = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_i] : idx_buffer ? idx_buffer[idx_i] : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
                         (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
@@ -15342,11 +16434,12 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
     {
         ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
+        ImU32* idx_buffer32 = (draw_list->IdxBuffer32.Size > 0) ? draw_list->IdxBuffer32.Data : NULL;
         ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_n] : idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -15463,7 +16556,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashTable.size_in_bytes(), storage->UseHashTable ? " (hash table)" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
         BulletText("Key 0x%08X Value { i: %d }", p.key, p.val_i); // Important: we currently don't store a type, real value may not be integer.
@@ -15528,6 +16621,7 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_IsPlatformWindow)  ? " IsPlatformWindow"  : "",
             (flags & ImGuiViewportFlags_IsPlatformMonitor) ? " IsPlatformMonitor" : "",
             (flags & ImGuiViewportFlags_OwnedByApp)        ? " OwnedByApp"        : "");
+        BulletText("Draw calls: %d in %d draw lists, %d after merging", viewport->DrawDataCmdCountBeforeMerge, viewport->DrawDataListCountBeforeMerge, viewport->DrawDataCmdCount);
         for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
             DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
         TreePop();
@@ -43,7 +43,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextFilterIndex, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeights, ImGuiTableSorter, ImGuiTableVirtualizer, ImGuiPlotMinMaxCache, Math Operators, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -166,6 +166,8 @@ struct ImFont;                      // Runtime data for a single font within a p
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
+struct ImFontDynamicGlyphs;         // Opaque state of a font using ImFontAtlasFlags_DynamicGlyphs.
+struct ImFontAtlasDynamicGlyphs;    // Opaque state of an atlas using ImFontAtlasFlags_DynamicGlyphs.
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
@@ -174,17 +176,22 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to clip large list of items of varying heights with ImGuiListClipper (Fenwick tree of heights)
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
+struct ImGuiPlotMinMaxCache;        // Helper to plot large arrays with PlotLines()/PlotHistogram() (min/max decimation)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSorter;            // Helper to sort a permutation of items according to table sort specs, using sort keys
+struct ImGuiTableVirtualizer;       // Helper to submit tables with a very large number of rows (clipping, row heights, sorted permutation)
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextFilterIndex;        // Helper to apply a text filter to a large number of lines, caching results
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -247,6 +254,7 @@ typedef void* ImTextureID;          // Default: store a pointer or an integer fi
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
+// - To use 16-bit indices + 32-bit indices for large meshes only: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32' and handle ImDrawList::IdxBuffer32.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
 #endif
@@ -266,6 +274,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImGuiJobFunc)(void* job_data, int job_index);                 // Function signature for jobs passed to ImGuiParallelForFunc
+typedef void    (*ImGuiParallelForFunc)(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data); // Function signature for ImFontAtlas::ParallelForFunc, ImGuiTableSorter::ParallelForFunc
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -487,6 +497,8 @@ namespace ImGui
     IMGUI_API void          Unindent(float indent_w = 0.0f);                                // move content position back to the left, by indent_w, or style.IndentSpacing if indent_w <= 0
     IMGUI_API void          BeginGroup();                                                   // lock horizontal starting position
     IMGUI_API void          EndGroup();                                                     // unlock horizontal starting position + capture the whole group bounding box into one "item" (so you can use IsItemHovered() or layout primitives such as SameLine() on whole group, etc.)
+    IMGUI_API bool          BeginClipGroup(const char* str_id, const ImVec2& size = ImVec2(0, 0)); // [BETA] group which contents are skipped when outside of the visible area: returns false and advances layout by 'size' (0.0f = use size measured last time it was submitted). Only call EndClipGroup() if BeginClipGroup() returns true!
+    IMGUI_API void          EndClipGroup();                                                 // only call EndClipGroup() if BeginClipGroup() returns true!
     IMGUI_API void          AlignTextToFramePadding();                                      // vertically align upcoming text baseline to FramePadding.y so that it will align properly to regularly framed items (call if you have text on a line before a framed item)
     IMGUI_API float         GetTextLineHeight();                                            // ~ FontSize
     IMGUI_API float         GetTextLineHeightWithSpacing();                                 // ~ FontSize + style.ItemSpacing.y (distance in pixels between 2 consecutive lines of text)
@@ -677,6 +689,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotMinMaxCache* values, int values_start = 0, int values_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));     // [BETA] Plot a range of values with min/max decimation. values_count = -1: up to last value.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotMinMaxCache* values, int values_start = 0, int values_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0)); // [BETA] Plot a range of values with min/max decimation. values_count = -1: up to last value.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -913,6 +927,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestRefresh(float delay = 0.0f);                                 // [BETA] request a new frame within 'delay' seconds (e.g. for your own animations). See io.WantRefresh/io.RefreshTimeout, for applications which idle between frames.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1553,6 +1568,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasIdx32      = 1 << 4,   // [BETA] Backend Renderer supports ImDrawList::IdxBuffer32. This enables output of large meshes (64K+ vertices) with 32-bit indices, in a single draw call, while other draw lists keep using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 5,   // [BETA] Backend Renderer supports partial updates of font atlas texture (uploads ImFontAtlas::TexDirtyRect when IsTexDirty() returns true). Required by ImFontAtlasFlags_DynamicGlyphs.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2171,6 +2188,9 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigWindowsHoverGrid;         // = false          // [BETA] When many windows are visible (e.g. thousands of child windows), index them in a grid while they are not moving, so finding the hovered window doesn't test every window. Doesn't change which window is hovered.
+    bool        ConfigMergeDrawLists;           // = false          // [BETA] Merge all draw lists of a viewport into a single one at the end of Render(), combining adjacent draw commands with same texture and compatible clipping rectangles to reduce draw calls. Costs a copy of vertices/indices. Requires renderer support of ImGuiBackendFlags_RendererHasVtxOffset or ImGuiBackendFlags_RendererHasIdx32 to merge over 64K vertices with 16-bit indices. See ImDrawData::MergeDrawLists().
+    bool        ConfigTextLayoutCache;          // = false          // [BETA] Cache size and glyph layout of text across frames (keyed by font, size, wrap width and contents). Speeds up CalcTextSize() and rendering of stable text (labels, TextWrapped()), costs memory.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2274,6 +2294,8 @@ struct ImGuiIO
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
+    bool        WantRefresh;                        // [BETA] Set by EndFrame()/Render() when the next frame will differ from this one even without new inputs (e.g. a window is appearing, a modal background is fading, a key is held for repeat). If false, you may idle until new input events or until 'RefreshTimeout' elapsed. Requires a backend using the io.AddXXXEvent() functions.
+    float       RefreshTimeout;                     // [BETA] Seconds after which a new frame is required for timed changes (blinking text cursor, tooltip delay, .ini saving, RequestRefresh() calls). 0.0f when WantRefresh is set, FLT_MAX when nothing is pending.
 
     //------------------------------------------------------------------
     // [Internal] Dear ImGui will maintain those fields. Forward compatibility not guaranteed!
@@ -2412,7 +2434,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextFilterIndex, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeights, ImGuiTableSorter, ImGuiTableVirtualizer, ImGuiPlotMinMaxCache, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2458,6 +2480,36 @@ struct ImGuiTextFilter
     int                     CountGrep;
 };
 
+// Helper: Apply an ImGuiTextFilter to a large number of lines (e.g. a log), caching the result. [BETA]
+// - Lines are stored in a text buffer + offset of each line start (e.g. ImGuiTextBuffer + ImVector<int>, as in ExampleAppLog in imgui_demo.cpp).
+//   Line n is [buf + line_offsets[n], buf + line_offsets[n + 1] - 1), the last line ends at buf_end.
+// - Call Update() every frame. Lines are filtered again only when the filter text changed, and new lines are filtered incrementally.
+//   Text is expected to only be appended: if the text or lines count shrinks we filter everything again. Call Invalidate() if you modified existing text.
+// - For each block of 16 lines we store a bitmap of hashed case-insensitive trigrams. This allows skipping blocks which can't contain any
+//   of the filter words, when all of them (excluding "-xxx" words) are at least 3 characters long.
+// Usage:
+//   static ImGuiTextFilterIndex filter_index;
+//   filter.Draw();
+//   filter_index.Update(&filter, buf.begin(), buf.end(), line_offsets.Data, line_offsets.Size);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(filter_index.PassingLines.Size);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           [...] // Display line filter_index.PassingLines[i]
+struct ImGuiTextFilterIndex
+{
+    ImVector<int>       PassingLines;       // Indices of lines passing the filter (all lines when the filter is not active)
+    ImVector<ImU32>     BlocksTrigrams;     // [Internal] Bitmap of hashed trigrams for each block of lines
+    int                 LinesCount;         // [Internal] Lines count when lines were last indexed and filtered
+    int                 TextSize;           // [Internal] Text size when lines were last indexed and filtered
+    char                FilterText[256];    // [Internal] Copy of filter InputBuf when lines were last filtered
+
+    ImGuiTextFilterIndex()  { LinesCount = TextSize = 0; FilterText[0] = 0; }
+    IMGUI_API void      Update(const ImGuiTextFilter* filter, const char* buf, const char* buf_end, const int* line_offsets, int lines_count);
+    void                Invalidate()        { PassingLines.resize(0); BlocksTrigrams.resize(0); LinesCount = TextSize = 0; }
+    void                Clear()             { PassingLines.clear(); BlocksTrigrams.clear(); LinesCount = TextSize = 0; FilterText[0] = 0; }
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2497,15 +2549,21 @@ struct ImGuiStoragePair
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
 // Types are NOT stored, so it is up to you to make sure your Key don't collide with different types.
+// For storages holding many thousands of keys with frequent insertion (e.g. state of very large trees), call SetUseHashTable(true)
+// on that instance: pairs are then appended unsorted and indexed by an open-addressing hash table, for O(1) insertion and lookup.
 struct ImGuiStorage
 {
     // [Internal]
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;           // Sorted by key, unless UseHashTable is set (then in insertion order)
+    ImVector<int>                   HashTable;      // When UseHashTable is set: open-addressing table (linear probing) of indices into Data[], -1 = empty slot.
+    bool                            UseHashTable;
+
+    ImGuiStorage()      { UseHashTable = false; }
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashTable.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2526,6 +2584,10 @@ struct ImGuiStorage
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+    // Advanced: select the lookup structure for this instance. May be called at any time, existing contents are preserved.
+    // - false (default): Data[] is kept sorted, O(log N) lookup, O(N) insertion. Most compact.
+    // - true: Data[] is indexed by a hash table, O(1) lookup and insertion. Costs an extra 8-16 bytes per pair.
+    IMGUI_API void      SetUseHashTable(bool enabled);
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -2560,15 +2622,17 @@ struct ImGuiListClipper
     int             DisplayStart;       // First item to display, updated by each call to Step()
     int             DisplayEnd;         // End of items to display (exclusive)
     int             ItemsCount;         // [Internal] Number of items
-    float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
+    float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it (average height when using ItemsHeights)
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Heights of items when using BeginWithHeights()
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginWithHeights(ImGuiListClipperHeights* heights, bool measure_heights = false); // [BETA] Items of varying heights, stored in 'heights' (must stay valid until End()). measure_heights: measure displayed items and update 'heights'.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2584,6 +2648,150 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of a list of items and their prefix sums, to use ImGuiListClipper with items of varying heights. [BETA]
+// Heights are stored in a Fenwick tree (binary indexed tree): getting an item offset, finding the visible items and changing
+// the height of an item are all O(log items_count). Building all heights is O(items_count), appending items is O(log items_count) each.
+// Two ways to use it:
+// - Heights known in advance: call Build() with a callback returning the height of each item, when items change.
+// - Heights measured by the clipper: call Resize() with an estimated height for new items, and pass measure_heights=true
+//   to BeginWithHeights(). The clipper then submits displayed items one at a time, measures them and updates their heights
+//   when they changed (e.g. first display, different wrapping width). Heights of items never displayed stay estimated.
+// Usage:
+//   static ImGuiListClipperHeights heights;
+//   heights.Resize(items_count, ImGui::GetTextLineHeightWithSpacing()); // Only new items use the estimated height
+//   ImGuiListClipper clipper;
+//   clipper.BeginWithHeights(&heights, true);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           [...]  // Submit items
+typedef float (*ImGuiListClipperHeightFunc)(void* user_data, int item_n);
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;            // Height of each item, including spacing
+    ImVector<double>    Tree;               // Fenwick tree: Tree[n] = sum of heights of items [n - (n & -n), n). Size is items count + 1 (or 0).
+
+    IMGUI_API void      Build(int items_count, ImGuiListClipperHeightFunc height_func, void* user_data);
+    IMGUI_API void      Resize(int items_count, float new_items_height);    // Keep heights of existing items, new items use 'new_items_height'
+    IMGUI_API void      SetItemHeight(int item_n, float height);
+    void                Clear()                             { Heights.clear(); Tree.clear(); }
+    int                 GetItemsCount() const               { return Heights.Size; }
+    float               GetItemHeight(int item_n) const     { IM_ASSERT(item_n >= 0 && item_n < Heights.Size); return Heights.Data[item_n]; }
+    IMGUI_API double    GetItemOffset(int item_n) const;    // Return sum of heights of items [0..item_n), item_n in [0, items_count]
+    double              GetTotalHeight() const              { return GetItemOffset(Heights.Size); }
+    IMGUI_API int       FindItemAtOffset(double offset) const;  // Return index of item covering given offset, clamped to [0, items_count - 1]
+};
+
+// Helper: Sort a permutation of item indices according to table sort specs, using sort keys extracted from your items. [BETA]
+// - Instead of calling a compare function O(items_count * log(items_count)) times, we call your key function once per item
+//   and sort spec, then run a stable LSD radix sort on the keys. Items with equal keys are kept in item index order.
+// - Keys are doubles, compared as numbers (exact for integers up to 2^53). For text columns, you may return a rank (e.g. index in a sorted list of unique strings).
+// - When only secondary sort specs changed (e.g. shift-clicking another column), the previous permutation is reused and we only sort
+//   groups of items with equal primary keys. Call Invalidate() when your items changed, to sort from scratch.
+// - Set ParallelForFunc to extract keys and sort on multiple threads. Output is identical to a single-threaded sort.
+// Usage:
+//   static ImVector<int> indices;
+//   static ImGuiTableSorter sorter;
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+//       if (sort_specs->SpecsDirty)
+//       {
+//           sorter.Sort(sort_specs, &indices, items_count, MyGetSortKey, &my_data);  // Then display items[indices[row_n]]
+//           sort_specs->SpecsDirty = false;
+//       }
+typedef double (*ImGuiTableSortKeyFunc)(void* user_data, const ImGuiTableColumnSortSpecs* sort_spec, int item_n); // Return sort key of an item for a given column (use sort_spec->ColumnIndex or ColumnUserID)
+struct ImGuiTableSorter
+{
+    ImGuiParallelForFunc    ParallelForFunc;        // Optional: let Sort() run on multiple threads. Must call job_func(job_data, n) for every n in [0..job_count-1], in any order/thread, and return once all are completed. Your key function must then be thread-safe.
+    void*                   ParallelForUserData;    // User data passed to ParallelForFunc.
+    int                     PrevItemsCount;         // [Internal] Items count of last sort
+    bool                    NeedFullSort;           // [Internal] Set by Invalidate()
+    ImVector<ImGuiTableColumnSortSpecs> PrevSpecs;  // [Internal] Sort specs of last sort
+    ImVector<ImU64>         Keys;                   // [Internal] Temporary buffers, freed after each sort
+    ImVector<ImU64>         TempKeys;               // [Internal]
+    ImVector<int>           TempIndices;            // [Internal]
+
+    ImGuiTableSorter()      { ParallelForFunc = NULL; ParallelForUserData = NULL; PrevItemsCount = -1; NeedFullSort = true; }
+    IMGUI_API void  Sort(const ImGuiTableSortSpecs* sort_specs, ImVector<int>* indices, int items_count, ImGuiTableSortKeyFunc key_func, void* user_data); // Sort 'indices' (previous output of Sort())
+    void            Invalidate()                    { NeedFullSort = true; }
+};
+
+// Helper: Submit a table with a very large number of rows, at a per-frame cost proportional to the number of visible rows. [BETA]
+// - Rows are clipped with ImGuiListClipper. Rows have a fixed height, or a height returned by RowHeightFunc (stored in an ImGuiListClipperHeights).
+// - When SortKeyFunc or CompareFunc is set and the table has sort specs, we keep a sorted permutation of your items, re-sorted only when the sort specs
+//   are dirty (e.g. user clicked a column header) or after calling Invalidate(). The sort is stable. Clears ImGuiTableSortSpecs::SpecsDirty.
+//   Prefer SortKeyFunc for large tables: it is much faster and can use multiple threads (see ImGuiTableSorter, set Sorter.ParallelForFunc).
+// - Call Invalidate() when your items change (other than their count), so row heights and sorted permutation are rebuilt.
+// Usage:
+//   static ImGuiTableVirtualizer virt;
+//   virt.UserData = &my_data;
+//   virt.RowHeightFunc = MyGetItemRowHeight;   // Optional: or set virt.RowHeight
+//   virt.SortKeyFunc = MyGetSortKey;           // Optional: or set virt.CompareFunc
+//   if (ImGui::BeginTable("table", 3, ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable))
+//   {
+//       [...]                                  // TableSetupColumn(), TableSetupScrollFreeze(), TableHeadersRow()
+//       virt.Begin(items_count);
+//       while (virt.Step())
+//           for (int row_n = virt.DisplayStart; row_n < virt.DisplayEnd; row_n++)
+//           {
+//               const int item_n = virt.GetItemIndex(row_n);
+//               virt.NextRow(row_n);           // Call TableNextRow() with row height
+//               [...]                          // TableNextColumn(), submit cells contents for 'item_n'
+//           }
+//       ImGui::EndTable();
+//   }
+typedef float (*ImGuiTableVirtualizerHeightFunc)(void* user_data, int item_n);
+typedef int   (*ImGuiTableVirtualizerCompareFunc)(void* user_data, const ImGuiTableSortSpecs* sort_specs, int item_a, int item_b); // Return <0, 0 or >0
+struct ImGuiTableVirtualizer
+{
+    void*                   UserData;           // User data passed to callbacks
+    ImGuiTableVirtualizerHeightFunc RowHeightFunc; // Optional: return height of the row of a given item. Heights are queried for all items when rebuilding.
+    ImGuiTableSortKeyFunc   SortKeyFunc;        // Optional: return sort key of an item for a given column. Items are sorted with Sorter.
+    ImGuiTableVirtualizerCompareFunc CompareFunc;  // Optional: compare two items according to sort specs. Slower than SortKeyFunc, but more flexible.
+    float                   RowHeight;          // Row height when RowHeightFunc is NULL. Use 0.0f to use the height of the first row, measured by ImGuiListClipper.
+    int                     DisplayStart;       // First row to display, updated by each call to Step()
+    int                     DisplayEnd;         // End of rows to display (exclusive)
+    int                     ItemsCount;         // [Internal] Number of items
+    bool                    NeedRebuild;        // [Internal] Set by Invalidate()
+    ImVector<int>           ItemIndices;        // [Internal] Item index for each row, when sorted
+    ImVector<int>           SortTempBuffer;     // [Internal]
+    ImGuiListClipperHeights RowHeights;         // [Internal] Row heights when using RowHeightFunc
+    ImGuiTableSorter        Sorter;             // Sorter used with SortKeyFunc. You may set Sorter.ParallelForFunc.
+    ImGuiListClipper        Clipper;            // [Internal]
+
+    ImGuiTableVirtualizer()                     { UserData = NULL; RowHeightFunc = NULL; SortKeyFunc = NULL; CompareFunc = NULL; RowHeight = 0.0f; DisplayStart = DisplayEnd = 0; ItemsCount = -1; NeedRebuild = false; }
+    IMGUI_API void  Begin(int items_count);     // Call after TableHeadersRow() (sort specs are read from the current table)
+    IMGUI_API bool  Step();                     // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those rows.
+    IMGUI_API void  NextRow(int row_n, ImGuiTableRowFlags row_flags = 0); // Call TableNextRow() with height of given row
+    void            Invalidate()                { NeedRebuild = true; }
+    int             GetItemIndex(int row_n) const { IM_ASSERT(row_n >= 0 && row_n < ItemsCount); return ItemIndices.Size > 0 ? ItemIndices.Data[row_n] : row_n; }
+};
+
+// Helper: Min/max decimation of a large array of values, for PlotLines()/PlotHistogram(). [BETA]
+// When there are more values than pixels, regular plots sample one value per pixel column: this costs O(values_count)
+// to find the scale, and spikes between samples are lost. Plotting with this helper draws the min/max envelope of
+// the values covered by each pixel column, in O(width * log(values_count / width)).
+// - Call Update() after appending values to your array: only new values are processed.
+//   Values which were already processed must not be modified: call Clear() if they are.
+// - Levels use about 2.7 bytes per value, in addition to your array (which is not copied).
+// Usage:
+//   static ImVector<float> values;
+//   static ImGuiPlotMinMaxCache values_cache;
+//   values.push_back(...);
+//   values_cache.Update(values.Data, values.Size);
+//   ImGui::PlotLines("Values", &values_cache);
+struct ImGuiPlotMinMaxCache
+{
+    const float*        Values;             // Values passed to last Update()
+    int                 ValuesCount;
+    int                 Stride;
+    ImVector<ImVec2>    Levels[15];         // Levels[n][i] = min/max of values [i * 4^(n+1), (i+1) * 4^(n+1)). Last item of each level may be partial.
+
+    ImGuiPlotMinMaxCache()                  { Values = NULL; ValuesCount = 0; Stride = sizeof(float); }
+    IMGUI_API void  Clear();
+    IMGUI_API void  Update(const float* values, int values_count, int stride = sizeof(float));   // values_count < ValuesCount restarts from scratch
+    IMGUI_API bool  GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const;  // Return false if there are no values in range (NaN values are ignored)
+    inline float    GetValue(int idx) const { IM_ASSERT(idx >= 0 && idx < ValuesCount); return *(const float*)(const void*)((const unsigned char*)Values + (size_t)idx * Stride); }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2688,6 +2896,7 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - IdxOffset: When the draw list uses 32-bit indices (ImDrawList::IdxBuffer32 not empty), this is an offset in IdxBuffer32.
 // - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -2782,7 +2991,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' or 'ImGuiBackendFlags_RendererHasIdx32' is enabled.
 };
 
 // Draw command list
@@ -2794,11 +3003,13 @@ enum ImDrawListFlags_
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix to want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
 // Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Multiple ImDrawList instances may be filled concurrently on different threads then appended with AppendDrawList(): read the rules above ImDrawListSharedData in imgui_internal.h.
 struct ImDrawList
 {
     // This is what you have to render
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
+    ImVector<ImU32>         IdxBuffer32;        // [BETA] 32-bit index buffer. When not empty, it is used instead of IdxBuffer (which is empty). See ConvertIdxBufferTo32(), ImGuiBackendFlags_RendererHasIdx32.
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
@@ -2808,6 +3019,7 @@ struct ImDrawList
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImVector<ImVec2>        _Path;              // [Internal] current path building
+    ImVector<ImVec2>        _TempBuffer;        // [Internal] temporary buffer for normals and triangulation (owned by each draw list so they may be filled on different threads)
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
@@ -2888,6 +3100,8 @@ struct ImDrawList
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  ConvertIdxBufferTo32();                                     // [BETA] Move indices to IdxBuffer32 and merge commands which were split every 64K vertices with 16-bit indices. Only call on a finished draw list. Done by Render() for large draw lists when renderer sets ImGuiBackendFlags_RendererHasIdx32.
+    IMGUI_API void  AppendDrawList(const ImDrawList* src);                      // Append the output of another draw list (e.g. filled on a worker thread), clipped by current clip rectangle. Channels of 'src' must be merged.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2952,6 +3166,7 @@ struct ImDrawData
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  MergeDrawLists(ImDrawList* out_list);   // [BETA] Helper to merge all draw lists into 'out_list', combining adjacent compatible ImDrawCmd to reduce draw calls. CmdLists becomes { out_list }. Done by Render() when io.ConfigMergeDrawLists is set.
 };
 
 //-----------------------------------------------------------------------------
@@ -3034,6 +3249,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // [BETA] Build() only rasterizes GlyphRanges, leaving free texture space. Other glyphs available in font data are rasterized on demand (visible from the frame after their first use), evicting least recently used ones when full. Backend needs to upload TexDirtyRect and set ImGuiBackendFlags_RendererHasTexUpdates. Requires stb_truetype builder, and keeping input and texture data (don't call ClearInputData()/ClearTexData()).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3078,6 +3294,16 @@ struct ImFontAtlas
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
+    bool                        IsTexDirty() const          { return TexDirtyRect.x < TexDirtyRect.z; }   // [BETA] With ImFontAtlasFlags_DynamicGlyphs: backend needs to upload TexDirtyRect region of texture, then call ClearTexDirty().
+    void                        ClearTexDirty()             { TexDirtyRect = ImVec4(0.0f, 0.0f, 0.0f, 0.0f); }
+
+    // [BETA] Persistent cache of the built atlas (texture, glyphs, custom rectangles positions), to skip Build() on next runs.
+    // - Typical use, after adding fonts: 'if (!atlas->LoadCacheFromFile("fonts.cache")) { atlas->Build(); atlas->SaveCacheToFile("fonts.cache"); }'
+    // - LoadCache*() return false if the data is missing, invalid, or was built from different fonts data or settings (cache is keyed by hashes of all inputs, font settings are also compared as-is).
+    // - Save right after Build(), before writing your own pixels into custom rectangles. Cache data is not portable across versions/builds of Dear ImGui.
+    IMGUI_API bool              LoadCacheFromFile(const char* filename);
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);    // e.g. memory-mapped cache file. Data doesn't need to persist after the call.
+    IMGUI_API bool              SaveCacheToFile(const char* filename);
 
     //-------------------------------------------
     // Glyph Ranges
@@ -3126,6 +3352,8 @@ struct ImFontAtlas
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    ImGuiParallelForFunc        ParallelForFunc;    // [BETA] Optional: let Build() rasterize glyphs on multiple threads. Must call job_func(job_data, n) for every n in [0..job_count-1], in any order/thread, and return once all are completed. Allocators (see SetAllocatorFunctions()) must then be thread-safe. Output is identical to a single-threaded build. Currently only used by the stb_truetype builder.
+    void*                       ParallelForUserData;// [BETA] User data passed to ParallelForFunc.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -3141,10 +3369,12 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexDirtyRect;       // Region of texture (x0, y0, x1, y1 in pixels) modified since it was built, with ImFontAtlasFlags_DynamicGlyphs. See IsTexDirty().
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
     unsigned int                FontBuilderFlags;   // Shared flags (for all fonts) for custom font builder. THIS IS BUILD IMPLEMENTATION DEPENDENT. Per-font override is also available in ImFontConfig.
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // Set by Build() with ImFontAtlasFlags_DynamicGlyphs.
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
@@ -3182,12 +3412,13 @@ struct ImFont
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    mutable ImFontDynamicGlyphs* DynamicGlyphs;     // 4-8   // out //            // Set with ImFontAtlasFlags_DynamicGlyphs: glyphs missing from the font are requested by FindGlyph(). Mutable: modified by const lookup functions.
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
-    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
+    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;         // With ImFontAtlasFlags_DynamicGlyphs: also queues missing glyphs and records glyph usage, so only call from the thread calling NewFrame(). Use FindGlyphNoFallback() elsewhere.
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
     float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
@@ -467,6 +467,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             // The "NoMouse" option can get us stuck with a disabled mouse! Let's provide an alternative way to fix it:
             if (io.ConfigFlags & ImGuiConfigFlags_NoMouse)
             {
+                ImGui::RequestRefresh(0.20f - fmodf((float)ImGui::GetTime(), 0.20f)); // Keep blinking when the application idles between frames
                 if (fmodf((float)ImGui::GetTime(), 0.40f) < 0.20f)
                 {
                     ImGui::SameLine();
@@ -501,6 +502,12 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
+            ImGui::SeparatorText("Performance");
+            ImGui::Checkbox("io.ConfigTextLayoutCache", &io.ConfigTextLayoutCache);
+            ImGui::SameLine(); HelpMarker("Cache size and glyph layout of word-wrapped text across frames. Speeds up UI with lots of stable wrapped text, at the cost of memory.\n\nSee Metrics/Debugger->Internal state for hit/miss counters.");
+            ImGui::Checkbox("io.ConfigWindowsHoverGrid", &io.ConfigWindowsHoverGrid);
+            ImGui::SameLine(); HelpMarker("Index windows in a grid to find the hovered window. Only useful with thousands of visible windows (e.g. child windows in a node graph).");
+
             ImGui::SeparatorText("Debug");
             ImGui::Checkbox("io.ConfigDebugIsDebuggerPresent", &io.ConfigDebugIsDebuggerPresent);
             ImGui::SameLine(); HelpMarker("Enable various tools calling IM_DEBUG_BREAK().\n\nRequires a debugger being attached, otherwise IM_DEBUG_BREAK() options will appear to crash your application.");
@@ -532,6 +539,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasIdx32",     &io.BackendFlags, ImGuiBackendFlags_RendererHasIdx32);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasTexUpdates", &io.BackendFlags, ImGuiBackendFlags_RendererHasTexUpdates);
             ImGui::EndDisabled();
             ImGui::TreePop();
             ImGui::Spacing();
@@ -834,6 +843,7 @@ static void ShowDemoWindowWidgets()
             static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
             ImGui::PlotLines("Curve", arr, IM_ARRAYSIZE(arr));
             ImGui::Text("Sin(time) = %f", sinf((float)ImGui::GetTime()));
+            ImGui::RequestRefresh(); // Animated contents: request a new frame when the application idles between frames
             ImGui::EndTooltip();
         }
 
@@ -1452,7 +1462,10 @@ static void ShowDemoWindowWidgets()
             const float time = (float)ImGui::GetTime();
             const bool winning_state = memchr(selected, 0, sizeof(selected)) == NULL; // If all cells are selected...
             if (winning_state)
+            {
                 ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f + 0.5f * cosf(time * 2.0f), 0.5f + 0.5f * sinf(time * 3.0f)));
+                ImGui::RequestRefresh();
+            }
 
             for (int y = 0; y < 4; y++)
                 for (int x = 0; x < 4; x++)
@@ -1867,6 +1880,8 @@ static void ShowDemoWindowWidgets()
         static double refresh_time = 0.0;
         if (!animate || refresh_time == 0.0)
             refresh_time = ImGui::GetTime();
+        if (animate)
+            ImGui::RequestRefresh(); // Request a new frame when the application idles between frames (see io.WantRefresh)
         while (refresh_time < ImGui::GetTime()) // Create data at fixed 60 Hz rate for the demo
         {
             static float phase = 0.0f;
@@ -1905,6 +1920,33 @@ static void ShowDemoWindowWidgets()
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Use ImGuiPlotMinMaxCache to plot large arrays: each pixel column displays min/max of the values it covers,
+        // so spikes are not lost, and cost doesn't depend on the number of values.
+        ImGui::SeparatorText("Large data (min/max decimation)");
+        static ImVector<float> large_values;
+        static ImGuiPlotMinMaxCache large_values_cache;
+        static int large_values_view = 0;
+        if (large_values.Size == 0 || (animate && large_values.Size < 1000000))
+        {
+            for (int n = 0; n < 2000; n++)
+            {
+                const int i = large_values.Size;
+                large_values.push_back(sinf(i * 0.0005f) * 0.5f + (((unsigned int)i * 7919u) % 1000) * 0.0002f + ((i % 33331) == 0 ? 0.8f : 0.0f));
+            }
+            large_values_cache.Update(large_values.Data, large_values.Size); // Only process new values
+        }
+        ImGui::Text("%d values", large_values.Size);
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Clear"))
+        {
+            large_values.clear();
+            large_values_cache.Clear();
+        }
+        ImGui::SliderInt("View", &large_values_view, 0, 2, large_values_view == 0 ? "All" : large_values_view == 1 ? "Last half" : "Last 1000");
+        const int large_values_start = (large_values_view == 0) ? 0 : (large_values_view == 1) ? large_values.Size / 2 : IM_MAX(large_values.Size - 1000, 0);
+        ImGui::PlotLines("Lines##large", &large_values_cache, large_values_start, -1, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::PlotHistogram("Histogram##large", &large_values_cache, large_values_start, -1, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
         ImGui::Separator();
 
         ImGui::TreePop();
@@ -1918,6 +1960,7 @@ static void ShowDemoWindowWidgets()
         progress += progress_dir * 0.4f * ImGui::GetIO().DeltaTime;
         if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
         if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
+        ImGui::RequestRefresh(); // Request a new frame when the application idles between frames (see io.WantRefresh)
 
         // Typically we would use ImVec2(-1.0f,0.0f) or ImVec2(-FLT_MIN,0.0f) to use all available width,
         // or ImVec2(width,0.0f) for a specified width. ImVec2(0.0f,0.0f) uses ItemWidth.
@@ -3131,6 +3174,48 @@ static void ShowDemoWindowLayout()
         ImGui::TreePop();
     }
 
+    IMGUI_DEMO_MARKER("Layout/Clip Groups");
+    if (ImGui::TreeNode("Clip Groups"))
+    {
+        HelpMarker(
+            "BeginClipGroup() starts a group which is entirely skipped when outside of the visible area, "
+            "using the size it had last time it was submitted (or a size you provide).\n"
+            "When it returns false, layout is advanced as if the group had been submitted. "
+            "Only call EndClipGroup() if BeginClipGroup() returned true.");
+        static bool use_clip_groups = true;
+        ImGui::Checkbox("Use BeginClipGroup()", &use_clip_groups);
+        static float values[100] = {};
+        int panels_submitted = 0;
+        if (ImGui::BeginChild("##panels", ImVec2(0.0f, ImGui::GetFontSize() * 20.0f), ImGuiChildFlags_Border))
+        {
+            for (int n = 0; n < 100; n++)
+            {
+                ImGui::PushID(n);
+                if (!use_clip_groups || ImGui::BeginClipGroup("panel"))
+                {
+                    panels_submitted++;
+                    if (ImGui::TreeNode("Panel", "Panel %d", n))
+                    {
+                        for (int section_n = 0; section_n < 3; section_n++)
+                            if (ImGui::TreeNode((void*)(intptr_t)section_n, "Section %d", section_n))
+                            {
+                                ImGui::SliderFloat("Value", &values[n], 0.0f, 1.0f);
+                                ImGui::Button("Apply");
+                                ImGui::TreePop();
+                            }
+                        ImGui::TreePop();
+                    }
+                    if (use_clip_groups)
+                        ImGui::EndClipGroup();
+                }
+                ImGui::PopID();
+            }
+        }
+        ImGui::EndChild();
+        ImGui::Text("%d/100 panels submitted", panels_submitted);
+        ImGui::TreePop();
+    }
+
     IMGUI_DEMO_MARKER("Layout/Text Baseline Alignment");
     if (ImGui::TreeNode("Text Baseline Alignment"))
     {
@@ -5655,6 +5740,64 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Virtualized");
+    if (ImGui::TreeNode("Virtualized"))
+    {
+        HelpMarker(
+            "Using ImGuiTableVirtualizer to display 1,000,000 rows of varying heights.\n"
+            "Only visible rows are submitted. Sorting only sorts a permutation of item indices, and only when sort specs changed.\n"
+            "Sorting uses sort keys (ImGuiTableSorter): shift-clicking a secondary column reuses the order of the primary column.");
+
+        // Our items data is generated from their index. Every 5th item has a description over three lines.
+        struct VirtualItems
+        {
+            static int   GetQuantity(int item_n)        { return (int)(((unsigned int)item_n * 2654435761u) % 1000); }
+            static bool  IsLarge(int item_n)            { return (item_n % 5) == 0; }
+            static float GetRowHeight(void*, int item_n){ return ImGui::GetTextLineHeight() * (IsLarge(item_n) ? 3 : 1) + ImGui::GetStyle().CellPadding.y * 2.0f; }
+            static double GetSortKey(void*, const ImGuiTableColumnSortSpecs* sort_spec, int item_n) { return (sort_spec->ColumnIndex == 0) ? item_n : GetQuantity(item_n); } // Sort is stable: items with equal keys stay in index order
+        };
+
+        static ImGuiTableVirtualizer virt;
+        virt.RowHeightFunc = VirtualItems::GetRowHeight;
+        virt.SortKeyFunc = VirtualItems::GetSortKey;
+
+        // Our row heights depend on font size: rebuild them when it changes
+        static float last_font_size = 0.0f;
+        if (last_font_size != ImGui::GetFontSize())
+            virt.Invalidate();
+        last_font_size = ImGui::GetFontSize();
+
+        static ImGuiTableFlags flags =
+            ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti
+            | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_virtualized", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID",          ImGuiTableColumnFlags_DefaultSort          | ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Quantity",    ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Description", ImGuiTableColumnFlags_NoSort               | ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupScrollFreeze(0, 1); // Make row always visible
+            ImGui::TableHeadersRow();
+
+            virt.Begin(1000000);
+            while (virt.Step())
+                for (int row_n = virt.DisplayStart; row_n < virt.DisplayEnd; row_n++)
+                {
+                    const int item_n = virt.GetItemIndex(row_n);
+                    virt.NextRow(row_n);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%07d", item_n);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", VirtualItems::GetQuantity(item_n));
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(VirtualItems::IsLarge(item_n) ? "Larger item\nwith a description\nover three lines" : "Item");
+                }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -6564,6 +6707,12 @@ void ImGui::ShowAboutWindow(bool* p_open)
 #ifdef IMGUI_DISABLE_DEFAULT_ALLOCATORS
         ImGui::Text("define: IMGUI_DISABLE_DEFAULT_ALLOCATORS");
 #endif
+#ifdef IMGUI_USE_FAST_HASH
+        ImGui::Text("define: IMGUI_USE_FAST_HASH");
+#endif
+#ifdef IMGUI_USE_CRC32C_HASH
+        ImGui::Text("define: IMGUI_USE_CRC32C_HASH");
+#endif
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
         ImGui::Text("define: IMGUI_USE_BGRA_PACKED_COLOR");
 #endif
@@ -6616,11 +6765,15 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigTextLayoutCache)                                   ImGui::Text("io.ConfigTextLayoutCache");
+        if (io.ConfigWindowsHoverGrid)                                  ImGui::Text("io.ConfigWindowsHoverGrid");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasIdx32)       ImGui::Text(" RendererHasIdx32");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)  ImGui::Text(" RendererHasTexUpdates");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -7508,6 +7661,7 @@ struct ExampleAppLog
 {
     ImGuiTextBuffer     Buf;
     ImGuiTextFilter     Filter;
+    ImGuiTextFilterIndex FilterIndex; // Cache lines passing the filter
     ImVector<int>       LineOffsets; // Index to lines offset. We maintain this with AddLog() calls.
     bool                AutoScroll;  // Keep scrolling if already at the bottom.
 
@@ -7575,17 +7729,23 @@ struct ExampleAppLog
             const char* buf_end = Buf.end();
             if (Filter.IsActive())
             {
-                // In this example we don't use the clipper when Filter is enabled.
-                // This is because we don't have random access to the result of our filter.
-                // A real application processing logs with ten of thousands of entries may want to store the result of
-                // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
-                for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+                // When Filter is enabled, we use ImGuiTextFilterIndex to store the result of our filter.
+                // It only filters lines again when the filter changed, or for new lines. This gives us random access to
+                // the lines passing the filter, so we can use the clipper as well.
+                FilterIndex.Update(&Filter, buf, buf_end, LineOffsets.Data, LineOffsets.Size);
+                ImGuiListClipper clipper;
+                clipper.Begin(FilterIndex.PassingLines.Size);
+                while (clipper.Step())
                 {
-                    const char* line_start = buf + LineOffsets[line_no];
-                    const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    if (Filter.PassFilter(line_start, line_end))
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    {
+                        const int line_no = FilterIndex.PassingLines[i];
+                        const char* line_start = buf + LineOffsets[line_no];
+                        const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
                         ImGui::TextUnformatted(line_start, line_end);
+                    }
                 }
+                clipper.End();
             }
             else
             {
@@ -7599,9 +7759,7 @@ struct ExampleAppLog
                 // - A) random access into your data
                 // - B) items all being the  same height,
                 // both of which we can handle since we have an array pointing to the beginning of each line of text.
-                // When using the filter (in the block of code above) we don't have random access into the data to display
-                // anymore, which is why we don't use the clipper. Storing or skimming through the search result would make
-                // it possible (and would be recommended if you want to search through tens of thousands of entries).
+                // When using the filter (in the block of code above) we display lines from the stored search result.
                 ImGuiListClipper clipper;
                 clipper.Begin(LineOffsets.Size);
                 while (clipper.Step())
@@ -7832,7 +7990,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), clipped with measured heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -7868,6 +8027,24 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(), lines have varying heights which depend on window width.
+            // The clipper measures displayed lines and stores their heights. Lines never displayed use an estimated height.
+            static ImGuiListClipperHeights heights;
+            heights.Resize(lines, ImGui::GetTextLineHeight());
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.BeginWithHeights(&heights, true);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    if (i % 10 == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. Every 10th line is longer and will wrap when the window is narrow enough.", i);
+                    else
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog", i);
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -8122,6 +8299,7 @@ static void ShowExampleAppWindowTitles(bool*)
     ImGui::SetNextWindowPos(ImVec2(base_pos.x + 100, base_pos.y + 300), ImGuiCond_FirstUseEver);
     ImGui::Begin(buf);
     ImGui::Text("This window has a changing title.");
+    ImGui::RequestRefresh();
     ImGui::End();
 }
 
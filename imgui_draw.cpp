@@ -128,10 +128,21 @@ namespace IMGUI_STB_NAMESPACE
 #endif
 
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
+// Allocator used by stb_truetype when rasterizing from jobs (see ImFontAtlas::ParallelForFunc): stbtt_fontinfo::userdata points to it.
+// This bypasses ImGui::MemAlloc()/MemFree() which update the current context debug counters and are therefore not thread-safe.
+struct ImFontBuildJobAllocator
+{
+    ImGuiMemAllocFunc   AllocFunc;
+    ImGuiMemFreeFunc    FreeFunc;
+    void*               UserData;
+};
+
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+static void* ImFontAtlasBuildJobAlloc(size_t sz, void* allocator)  { ImFontBuildJobAllocator* a = (ImFontBuildJobAllocator*)allocator; return a->AllocFunc(sz, a->UserData); }
+static void  ImFontAtlasBuildJobFree(void* ptr, void* allocator)   { ImFontBuildJobAllocator* a = (ImFontBuildJobAllocator*)allocator; a->FreeFunc(ptr, a->UserData); }
+#define STBTT_malloc(x,u)   ((u) ? ImFontAtlasBuildJobAlloc(x,u) : IM_ALLOC(x))
+#define STBTT_free(x,u)     ((u) ? ImFontAtlasBuildJobFree(x,u) : IM_FREE(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -403,6 +414,7 @@ void ImDrawList::_ResetForNewFrame()
 
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
+    IdxBuffer32.resize(0);
     VtxBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
@@ -421,6 +433,7 @@ void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
     IdxBuffer.clear();
+    IdxBuffer32.clear();
     VtxBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
@@ -429,6 +442,7 @@ void ImDrawList::_ClearFreeMemory()
     _ClipRectStack.clear();
     _TextureIdStack.clear();
     _Path.clear();
+    _TempBuffer.clear();
     _Splitter.ClearFreeMemory();
 }
 
@@ -437,11 +451,53 @@ ImDrawList* ImDrawList::CloneOutput() const
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
+    dst->IdxBuffer32 = IdxBuffer32;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
     return dst;
 }
 
+// Move indices to IdxBuffer32, so the renderer can draw meshes larger than 64K vertices without splitting them.
+// With 16-bit indices and ImDrawListFlags_AllowVtxOffset, PrimReserve() starts a new command with a new VtxOffset every 64K vertices:
+// indices are rebased on VtxOffset, and adjacent commands with same clipping rectangle and texture are merged back into one.
+void ImDrawList::ConvertIdxBufferTo32()
+{
+    if (IdxBuffer.Size == 0)
+        return;
+    IdxBuffer32.resize(IdxBuffer.Size);
+    ImU32* idx_write = IdxBuffer32.Data;
+    ImDrawCmd* cmd_write = CmdBuffer.Data;  // Commands are compacted in place
+    ImDrawCmd* merge_cmd = NULL;
+    for (int cmd_n = 0; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd cmd = CmdBuffer.Data[cmd_n];
+        if (cmd.UserCallback == NULL && cmd.ElemCount == 0)
+            continue;
+        const unsigned int idx_offset = (unsigned int)(idx_write - IdxBuffer32.Data);
+        if (cmd.UserCallback == NULL)
+        {
+            IM_ASSERT(cmd.IdxOffset + cmd.ElemCount <= (unsigned int)IdxBuffer.Size);
+            const ImDrawIdx* src_idx = IdxBuffer.Data + cmd.IdxOffset;
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                *idx_write++ = cmd.VtxOffset + src_idx[n];
+            if (merge_cmd != NULL && merge_cmd->TextureId == cmd.TextureId && memcmp(&merge_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) == 0)
+            {
+                merge_cmd->ElemCount += cmd.ElemCount;
+                continue;
+            }
+        }
+        cmd.VtxOffset = 0;
+        cmd.IdxOffset = idx_offset;
+        *cmd_write = cmd;
+        merge_cmd = (cmd.UserCallback == NULL) ? cmd_write : NULL;
+        cmd_write++;
+    }
+    CmdBuffer.shrink((int)(cmd_write - CmdBuffer.Data));
+    IdxBuffer32.shrink((int)(idx_write - IdxBuffer32.Data));
+    IdxBuffer.resize(0);
+    _IdxWritePtr = NULL;
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -566,6 +622,66 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+// Append the output of another draw list, typically filled on a worker thread (see threading rules above ImDrawListSharedData).
+// - Commands are clipped by our current clip rectangle, so a draw list filled with PushClipRectFullScreen() can be appended to a window.
+// - When ImDrawListFlags_AllowVtxOffset is set, commands get a new VtxOffset and indices are copied as-is.
+//   Otherwise indices are rebased, and total vertex count must fit in ImDrawIdx.
+void ImDrawList::AppendDrawList(const ImDrawList* src)
+{
+    IM_ASSERT(src != this);
+    IM_ASSERT(src->_Splitter._Count <= 1 && "Call ChannelsMerge() on source draw list before appending it!");
+    if (src->IdxBuffer.Size == 0 && src->CmdBuffer.Size <= 1 && (src->CmdBuffer.Size == 0 || src->CmdBuffer.Data[0].UserCallback == NULL))
+        return;
+
+    const int vtx_base = VtxBuffer.Size;
+    const int idx_base = IdxBuffer.Size;
+    const bool use_vtx_offset = (Flags & ImDrawListFlags_AllowVtxOffset) != 0;
+    VtxBuffer.resize(vtx_base + src->VtxBuffer.Size);
+    IdxBuffer.resize(idx_base + src->IdxBuffer.Size);
+    if (src->VtxBuffer.Size > 0)
+        memcpy(VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+    if (src->IdxBuffer.Size > 0)
+        memcpy(IdxBuffer.Data + idx_base, src->IdxBuffer.Data, (size_t)src->IdxBuffer.size_in_bytes());
+
+    // Append commands, removing our trailing unused command first
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    _PopUnusedDrawCmd();
+    for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+    {
+        if (src_cmd.ElemCount == 0 && src_cmd.UserCallback == NULL)
+            continue;
+        ImDrawCmd cmd = src_cmd;
+        cmd.ClipRect.x = ImMax(cmd.ClipRect.x, clip_rect.x);
+        cmd.ClipRect.y = ImMax(cmd.ClipRect.y, clip_rect.y);
+        cmd.ClipRect.z = ImMax(ImMin(cmd.ClipRect.z, clip_rect.z), cmd.ClipRect.x);
+        cmd.ClipRect.w = ImMax(ImMin(cmd.ClipRect.w, clip_rect.w), cmd.ClipRect.y);
+        cmd.IdxOffset += idx_base;
+        if (use_vtx_offset)
+        {
+            cmd.VtxOffset += vtx_base;
+        }
+        else
+        {
+            const unsigned int idx_rebase = vtx_base + src_cmd.VtxOffset;
+            IM_ASSERT((sizeof(ImDrawIdx) == 4 || vtx_base + src->VtxBuffer.Size <= (1 << 16)) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above ImDrawListFlags_AllowVtxOffset.");
+            for (ImDrawIdx* idx = IdxBuffer.Data + cmd.IdxOffset, *idx_end = idx + cmd.ElemCount; idx < idx_end; idx++)
+                *idx = (ImDrawIdx)(*idx + idx_rebase);
+            cmd.VtxOffset = 0;
+        }
+        CmdBuffer.push_back(cmd);
+        if (CmdBuffer.Size > 1)
+            _TryMergeDrawCmds();
+    }
+
+    // Restore state for our next primitives
+    if (use_vtx_offset)
+        _CmdHeader.VtxOffset = VtxBuffer.Size;
+    _VtxCurrentIdx = (unsigned int)(VtxBuffer.Size - _CmdHeader.VtxOffset);
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    AddDrawCmd();
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -713,6 +829,66 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// SIMD helpers for AddPolyline(): process 4 points at a time.
+// - Operations and their order match the scalar IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F() code (_mm_rsqrt_ps() matches the _mm_rsqrt_ss() used by ImRsqrt())
+//   so the output is bit-identical to the scalar path, unless the compiler contracts the scalar code into FMA instructions.
+// - Only SSE1 instructions are used, so this is available whenever IMGUI_ENABLE_SSE is defined.
+#ifdef IMGUI_ENABLE_SSE
+static inline void ImPolylineLoadVec2x4(const ImVec2* in, __m128& out_x, __m128& out_y)
+{
+    const __m128 a = _mm_loadu_ps(&in[0].x);
+    const __m128 b = _mm_loadu_ps(&in[2].x);
+    out_x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    out_y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Write { a[n], b[n] } into out[n * stride + 0] and out[n * stride + 1], for n = 0..3
+static inline void ImPolylineStoreVec2Pairsx4(ImVec2* out, int stride, __m128 a_x, __m128 a_y, __m128 b_x, __m128 b_y)
+{
+    const __m128 a_lo = _mm_unpacklo_ps(a_x, a_y), a_hi = _mm_unpackhi_ps(a_x, a_y);
+    const __m128 b_lo = _mm_unpacklo_ps(b_x, b_y), b_hi = _mm_unpackhi_ps(b_x, b_y);
+    _mm_storeu_ps(&out[stride * 0].x, _mm_movelh_ps(a_lo, b_lo));
+    _mm_storeu_ps(&out[stride * 1].x, _mm_movehl_ps(b_lo, a_lo));
+    _mm_storeu_ps(&out[stride * 2].x, _mm_movelh_ps(a_hi, b_hi));
+    _mm_storeu_ps(&out[stride * 3].x, _mm_movehl_ps(b_hi, a_hi));
+}
+
+// Segment normals for segments [i1, i1+4), requires points [i1, i1+5)
+static inline void ImPolylineCalcNormalsx4(const ImVec2* points, ImVec2* out_normals)
+{
+    __m128 x1, y1, x2, y2;
+    ImPolylineLoadVec2x4(points, x1, y1);
+    ImPolylineLoadVec2x4(points + 1, x2, y2);
+    __m128 dx = _mm_sub_ps(x2, x1);
+    __m128 dy = _mm_sub_ps(y2, y1);
+    const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+    const __m128 mask = _mm_cmpgt_ps(d2, _mm_setzero_ps());
+    const __m128 inv_len = _mm_or_ps(_mm_and_ps(mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+    dx = _mm_mul_ps(dx, inv_len);
+    dy = _mm_mul_ps(dy, inv_len);
+    const __m128 neg_dx = _mm_xor_ps(dx, _mm_set1_ps(-0.0f));
+    _mm_storeu_ps(&out_normals[0].x, _mm_unpacklo_ps(dy, neg_dx));
+    _mm_storeu_ps(&out_normals[2].x, _mm_unpackhi_ps(dy, neg_dx));
+}
+
+// Averaged and fixed normals at points [i1+1, i1+5), requires normals [i1, i1+5)
+static inline void ImPolylineCalcAveragedNormalsx4(const ImVec2* normals, __m128& out_dm_x, __m128& out_dm_y)
+{
+    __m128 x1, y1, x2, y2;
+    ImPolylineLoadVec2x4(normals, x1, y1);
+    ImPolylineLoadVec2x4(normals + 1, x2, y2);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 dm_x = _mm_mul_ps(_mm_add_ps(x1, x2), half);
+    const __m128 dm_y = _mm_mul_ps(_mm_add_ps(y1, y2), half);
+    const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+    const __m128 mask = _mm_cmpgt_ps(d2, _mm_set1_ps(0.000001f));
+    const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(_mm_set1_ps(1.0f), d2), _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2));
+    const __m128 scale = _mm_or_ps(_mm_and_ps(mask, inv_len2), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+    out_dm_x = _mm_mul_ps(dm_x, scale);
+    out_dm_y = _mm_mul_ps(dm_y, scale);
+}
+#endif
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -750,12 +926,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         // Temporary buffer
         // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        ImVec2* temp_normals = _TempBuffer.Data;
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        int i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+        for (; i1_start + 4 < points_count; i1_start += 4)
+            ImPolylineCalcNormalsx4(&points[i1_start], &temp_normals[i1_start]);
+#endif
+        for (int i1 = i1_start; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
             float dx = points[i2].x - points[i1].x;
@@ -789,14 +970,25 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+            const __m128 half_draw_size_4 = _mm_set1_ps(half_draw_size);
+            for (; i1_start + 4 < points_count; i1_start += 4)
+            {
+                __m128 dm_x, dm_y, p_x, p_y;
+                ImPolylineCalcAveragedNormalsx4(&temp_normals[i1_start], dm_x, dm_y);
+                ImPolylineLoadVec2x4(&points[i1_start + 1], p_x, p_y);
+                dm_x = _mm_mul_ps(dm_x, half_draw_size_4);
+                dm_y = _mm_mul_ps(dm_y, half_draw_size_4);
+                ImPolylineStoreVec2Pairsx4(&temp_points[(i1_start + 1) * 2], 2, _mm_add_ps(p_x, dm_x), _mm_add_ps(p_y, dm_y), _mm_sub_ps(p_x, dm_x), _mm_sub_ps(p_y, dm_y));
+            }
+#endif
+            for (int i1 = i1_start; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -811,7 +1003,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[0].y = points[i2].y + dm_y;
                 out_vtx[1].x = points[i2].x - dm_x;
                 out_vtx[1].y = points[i2].y - dm_y;
+            }
 
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -885,14 +1083,30 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+            const __m128 half_outer_thickness_4 = _mm_set1_ps(half_inner_thickness + AA_SIZE);
+            const __m128 half_inner_thickness_4 = _mm_set1_ps(half_inner_thickness);
+            for (; i1_start + 4 < points_count; i1_start += 4)
+            {
+                __m128 dm_x, dm_y, p_x, p_y;
+                ImPolylineCalcAveragedNormalsx4(&temp_normals[i1_start], dm_x, dm_y);
+                ImPolylineLoadVec2x4(&points[i1_start + 1], p_x, p_y);
+                const __m128 dm_out_x = _mm_mul_ps(dm_x, half_outer_thickness_4);
+                const __m128 dm_out_y = _mm_mul_ps(dm_y, half_outer_thickness_4);
+                const __m128 dm_in_x = _mm_mul_ps(dm_x, half_inner_thickness_4);
+                const __m128 dm_in_y = _mm_mul_ps(dm_y, half_inner_thickness_4);
+                ImVec2* out_vtx = &temp_points[(i1_start + 1) * 4];
+                ImPolylineStoreVec2Pairsx4(out_vtx + 0, 4, _mm_add_ps(p_x, dm_out_x), _mm_add_ps(p_y, dm_out_y), _mm_add_ps(p_x, dm_in_x), _mm_add_ps(p_y, dm_in_y));
+                ImPolylineStoreVec2Pairsx4(out_vtx + 2, 4, _mm_sub_ps(p_x, dm_in_x), _mm_sub_ps(p_y, dm_in_y), _mm_sub_ps(p_x, dm_out_x), _mm_sub_ps(p_y, dm_out_y));
+            }
+#endif
+            for (int i1 = i1_start; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -913,8 +1127,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[2].y = points[i2].y - dm_in_y;
                 out_vtx[3].x = points[i2].x - dm_out_x;
                 out_vtx[3].y = points[i2].y - dm_out_y;
+            }
 
-                // Add indexes
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
                 _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
@@ -999,8 +1218,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -1951,8 +2170,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        _TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        triangulator.Init(points, points_count, _TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -1961,8 +2180,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -2008,8 +2227,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        _TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        triangulator.Init(points, points_count, _TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2207,6 +2426,8 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     //         glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
     //       Your own engine or render API may use different parameters or function calls to specify index sizes.
     //       2 and 4 bytes indices are generally supported by most graphics API.
+    //   (C) Or handle ImDrawList::IdxBuffer32 in your renderer backend, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32'.
+    //       Render() will convert draw lists larger than 64K vertices to 32-bit indices, other draw lists keep 16-bit indices.
     // - If for some reason neither of those solutions works for you, a workaround is to call BeginChild()/EndChild() before reaching
     //   the 64K limit to split your draw commands in multiple draw lists.
     if (sizeof(ImDrawIdx) == 2)
@@ -2216,7 +2437,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     out_list->push_back(draw_list);
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
-    draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalIdxCount += draw_list->IdxBuffer.Size + draw_list->IdxBuffer32.Size;
 }
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
@@ -2234,6 +2455,16 @@ void ImDrawData::DeIndexAllBuffers()
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
+        if (cmd_list->IdxBuffer32.Size > 0)
+        {
+            new_vtx_buffer.resize(cmd_list->IdxBuffer32.Size);
+            for (int j = 0; j < cmd_list->IdxBuffer32.Size; j++)
+                new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer32[j]];
+            cmd_list->VtxBuffer.swap(new_vtx_buffer);
+            cmd_list->IdxBuffer32.resize(0);
+            TotalVtxCount += cmd_list->VtxBuffer.Size;
+            continue;
+        }
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
@@ -2255,6 +2486,131 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+// Return true if the clipping rectangle falls exactly on framebuffer pixel boundaries, in which case a scissor rectangle containing all
+// vertices of a command has no effect on its output and may be enlarged.
+static bool ImDrawCmdClipRectIsPixelAligned(const ImVec4& clip_rect, const ImVec2& display_pos, const ImVec2& fb_scale)
+{
+    const float v[4] = { (clip_rect.x - display_pos.x) * fb_scale.x, (clip_rect.y - display_pos.y) * fb_scale.y, (clip_rect.z - display_pos.x) * fb_scale.x, (clip_rect.w - display_pos.y) * fb_scale.y };
+    for (float f : v)
+        if (!(f > -16777216.0f && f < 16777216.0f) || ImTrunc(f) != f)
+            return false;
+    return true;
+}
+
+// Merge all draw lists into a single 'out_list' (which is cleared first), then make it the only list in CmdLists. Source draw lists are left untouched.
+// Adjacent ImDrawCmd are merged into a single draw call when they use the same texture and either:
+// - have the same ClipRect,
+// - or both have a pixel-aligned ClipRect which contains all their visible vertices: it doesn't clip anything, so the merged command can use the union of both rectangles.
+// Notes:
+// - With 16-bit indices, VtxOffset is used to address vertices past 64K: this requires renderer support (ImGuiBackendFlags_RendererHasVtxOffset) if TotalVtxCount >= 64K.
+// - User callbacks are preserved in order and never merged. Their 'parent_list' parameter will be 'out_list'.
+void ImDrawData::MergeDrawLists(ImDrawList* out_list)
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    out_list->CmdBuffer.resize(0);
+    out_list->IdxBuffer32.resize(0);    // 'out_list' may be reused after Render() converted it to 32-bit indices
+    out_list->VtxBuffer.resize(TotalVtxCount);
+    out_list->IdxBuffer.resize(TotalIdxCount);
+    ImDrawIdx* idx_write = out_list->IdxBuffer.Data;
+    ImDrawCmd* merge_cmd = NULL;        // Last output command, NULL if following commands can't be merged into it
+    bool merge_cmd_unclipped = false;   // merge_cmd->ClipRect is pixel-aligned and contains all its vertices
+    unsigned int vtx_base = 0;          // Offset of current source list in out_list->VtxBuffer
+    unsigned int vtx_offset = 0;        // Current output VtxOffset
+    for (ImDrawList* src_list : CmdLists)
+    {
+        IM_ASSERT(vtx_base + src_list->VtxBuffer.Size <= (unsigned int)out_list->VtxBuffer.Size);
+        IM_ASSERT(src_list->IdxBuffer32.Size == 0 && "Merge draw lists before calling ConvertIdxBufferTo32()!");
+        if (src_list->VtxBuffer.Size > 0)
+            memcpy(out_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.size_in_bytes());
+        for (const ImDrawCmd* src_cmd = src_list->CmdBuffer.Data; src_cmd < src_list->CmdBuffer.Data + src_list->CmdBuffer.Size; src_cmd++)
+        {
+            if (src_cmd->UserCallback == NULL && src_cmd->ElemCount == 0)
+                continue;
+
+            // With 16-bit indices, start a new VtxOffset when indices relative to current one could overflow
+            const unsigned int src_vtx_start = vtx_base + src_cmd->VtxOffset;
+            if (sizeof(ImDrawIdx) == 2 && src_vtx_start + ImMin((unsigned int)src_list->VtxBuffer.Size - src_cmd->VtxOffset, 1u << 16) - vtx_offset > (1u << 16))
+                vtx_offset = src_vtx_start;
+            const unsigned int out_idx_offset = (unsigned int)(idx_write - out_list->IdxBuffer.Data);
+            if (src_cmd->UserCallback != NULL)
+            {
+                out_list->CmdBuffer.push_back(*src_cmd);
+                out_list->CmdBuffer.back().VtxOffset = vtx_offset;
+                out_list->CmdBuffer.back().IdxOffset = out_idx_offset;
+                merge_cmd = NULL;
+                continue;
+            }
+
+            // Copy indices, calculating bounds of used vertices if they may allow merging with a different ClipRect
+            IM_ASSERT(out_idx_offset + src_cmd->ElemCount <= (unsigned int)out_list->IdxBuffer.Size);
+            const unsigned int idx_delta = src_vtx_start - vtx_offset;
+            const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd->IdxOffset;
+            const ImDrawIdx* src_idx_end = src_idx + src_cmd->ElemCount;
+            bool unclipped = ImDrawCmdClipRectIsPixelAligned(src_cmd->ClipRect, DisplayPos, FramebufferScale);
+            if (unclipped)
+            {
+                const ImDrawVert* src_vtx = src_list->VtxBuffer.Data + src_cmd->VtxOffset;
+                ImVec2 bb_min(FLT_MAX, FLT_MAX), bb_max(-FLT_MAX, -FLT_MAX);
+                for (; src_idx < src_idx_end; src_idx++)
+                {
+                    const ImVec2 pos = src_vtx[*src_idx].pos;
+                    bb_min.x = ImMin(bb_min.x, pos.x); bb_min.y = ImMin(bb_min.y, pos.y);
+                    bb_max.x = ImMax(bb_max.x, pos.x); bb_max.y = ImMax(bb_max.y, pos.y);
+                    *idx_write++ = (ImDrawIdx)(*src_idx + idx_delta);
+                }
+                // Vertices outside of the framebuffer are never visible, e.g. anti-aliasing fringe of a window touching the edge of the screen
+                bb_min = ImMax(bb_min, DisplayPos);
+                bb_max = ImMin(bb_max, DisplayPos + DisplaySize);
+                const ImVec4& clip = src_cmd->ClipRect;
+                unclipped = (bb_min.x > bb_max.x || bb_min.y > bb_max.y) || (bb_min.x >= clip.x && bb_min.y >= clip.y && bb_max.x <= clip.z && bb_max.y <= clip.w);
+            }
+            else if (idx_delta == 0)
+            {
+                memcpy(idx_write, src_idx, (size_t)src_cmd->ElemCount * sizeof(ImDrawIdx));
+                idx_write += src_cmd->ElemCount;
+            }
+            else
+            {
+                for (; src_idx < src_idx_end; src_idx++)
+                    *idx_write++ = (ImDrawIdx)(*src_idx + idx_delta);
+            }
+
+            // Merge with previous command or start a new one
+            if (merge_cmd != NULL && merge_cmd->TextureId == src_cmd->TextureId && merge_cmd->VtxOffset == vtx_offset)
+            {
+                if (memcmp(&merge_cmd->ClipRect, &src_cmd->ClipRect, sizeof(ImVec4)) == 0)
+                {
+                    merge_cmd->ElemCount += src_cmd->ElemCount;
+                    merge_cmd_unclipped &= unclipped;
+                    continue;
+                }
+                if (merge_cmd_unclipped && unclipped)
+                {
+                    ImVec4& clip = merge_cmd->ClipRect;
+                    clip = ImVec4(ImMin(clip.x, src_cmd->ClipRect.x), ImMin(clip.y, src_cmd->ClipRect.y), ImMax(clip.z, src_cmd->ClipRect.z), ImMax(clip.w, src_cmd->ClipRect.w));
+                    merge_cmd->ElemCount += src_cmd->ElemCount;
+                    continue;
+                }
+            }
+            out_list->CmdBuffer.push_back(*src_cmd);
+            merge_cmd = &out_list->CmdBuffer.back();
+            merge_cmd->VtxOffset = vtx_offset;
+            merge_cmd->IdxOffset = out_idx_offset;
+            merge_cmd_unclipped = unclipped;
+        }
+        vtx_base += (unsigned int)src_list->VtxBuffer.Size;
+    }
+    out_list->IdxBuffer.shrink((int)(idx_write - out_list->IdxBuffer.Data));
+    out_list->_VtxWritePtr = out_list->VtxBuffer.Data + out_list->VtxBuffer.Size;
+    out_list->_IdxWritePtr = out_list->IdxBuffer.Data + out_list->IdxBuffer.Size;
+    out_list->_VtxCurrentIdx = (unsigned int)out_list->VtxBuffer.Size - vtx_offset;
+    out_list->Flags = (vtx_offset != 0) ? (out_list->Flags | ImDrawListFlags_AllowVtxOffset) : (out_list->Flags & ~ImDrawListFlags_AllowVtxOffset);
+    TotalIdxCount = out_list->IdxBuffer.Size;
+    CmdLists.resize(0);
+    CmdLists.push_back(out_list);
+    CmdListsCount = 1;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -2402,6 +2758,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this);
     for (ImFontConfig& font_cfg : ConfigData)
         if (font_cfg.FontData && font_cfg.FontDataOwnedByAtlas)
         {
@@ -2425,6 +2782,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this);
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2438,6 +2796,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this);
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2703,6 +3062,319 @@ bool    ImFontAtlas::Build()
     return builder_io->FontBuilder_Build(this);
 }
 
+//-----------------------------------------------------------------------------
+// ImFontAtlas cache
+//-----------------------------------------------------------------------------
+// Store the output of Build() (texture, glyphs, custom rectangles positions) so next runs can skip building.
+// The data is keyed by two independent 32-bit hashes of all inputs of Build(), including font data. Settings of each ImFontConfig
+// are also stored raw and compared on load, so a hash collision alone cannot load data built from different settings.
+// It is not portable across builds of Dear ImGui.
+// Layout: ImFontAtlasCacheHeader, for each config: ImFontAtlasCacheConfig + glyph ranges[], TexUvLines[], CustomRects X/Y[],
+// then for each font: ImFontAtlasCacheFont + glyphs[], then Alpha8 pixels.
+//-----------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_CACHE_VERSION     2
+
+struct ImFontAtlasCacheHeader
+{
+    char            Magic[8];           // "imfcache"
+    ImU32           Version;            // IM_FONT_ATLAS_CACHE_VERSION
+    ImU32           Key[2];             // ImFontAtlasCacheCalcKey()
+    ImFontAtlasFlags Flags;             // Copy of ImFontAtlas settings
+    int             TexDesiredWidth;
+    int             TexGlyphPadding;
+    unsigned int    FontBuilderFlags;
+    int             ConfigsCount;
+    int             TexWidth, TexHeight;
+    ImVec2          TexUvWhitePixel;
+    int             FontsCount;
+    int             CustomRectsCount;
+};
+
+// Copy of ImFontConfig settings, followed by GlyphRangesCount ImWchar.
+struct ImFontAtlasCacheConfig
+{
+    int             FontDataSize;
+    int             FontNo;
+    int             DstFontIndex;
+    float           SizePixels;
+    int             OversampleH, OversampleV;
+    ImVec2          GlyphExtraSpacing;
+    ImVec2          GlyphOffset;
+    float           GlyphMinAdvanceX, GlyphMaxAdvanceX;
+    unsigned int    FontBuilderFlags;
+    float           RasterizerMultiply;
+    float           RasterizerDensity;
+    int             EllipsisChar;
+    int             PixelSnapH, MergeMode;
+    int             GlyphRangesCount;   // Number of ImWchar, excluding zero terminator
+};
+
+struct ImFontAtlasCacheFont
+{
+    float           Ascent, Descent;
+    int             MetricsTotalSurface;
+    int             GlyphsCount;
+};
+
+static const ImWchar* ImFontAtlasCacheGetGlyphRanges(ImFontAtlas* atlas, const ImFontConfig& cfg, int* out_count)
+{
+    const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+    int ranges_count = 0;
+    while (ranges[ranges_count] != 0)
+        ranges_count++;
+    *out_count = ranges_count;
+    return ranges;
+}
+
+static void ImFontAtlasCacheInitConfig(ImFontAtlas* atlas, const ImFontConfig& cfg, ImFontAtlasCacheConfig* out)
+{
+    memset(out, 0, sizeof(*out)); // Clear padding so the whole struct can be compared with memcmp()
+    out->FontDataSize = cfg.FontDataSize;
+    out->FontNo = cfg.FontNo;
+    out->DstFontIndex = atlas->Fonts.find_index(cfg.DstFont);
+    out->SizePixels = cfg.SizePixels;
+    out->OversampleH = cfg.OversampleH;
+    out->OversampleV = cfg.OversampleV;
+    out->GlyphExtraSpacing = cfg.GlyphExtraSpacing;
+    out->GlyphOffset = cfg.GlyphOffset;
+    out->GlyphMinAdvanceX = cfg.GlyphMinAdvanceX;
+    out->GlyphMaxAdvanceX = cfg.GlyphMaxAdvanceX;
+    out->FontBuilderFlags = cfg.FontBuilderFlags;
+    out->RasterizerMultiply = cfg.RasterizerMultiply;
+    out->RasterizerDensity = cfg.RasterizerDensity;
+    out->EllipsisChar = (int)cfg.EllipsisChar;
+    out->PixelSnapH = cfg.PixelSnapH ? 1 : 0;
+    out->MergeMode = cfg.MergeMode ? 1 : 0;
+    ImFontAtlasCacheGetGlyphRanges(atlas, cfg, &out->GlyphRangesCount);
+}
+
+// Two independent hashes, so that both need to collide. With IMGUI_USE_FAST_HASH, ImHashData() is ImHashDataFast(): use a different seed.
+struct ImFontAtlasCacheHasher
+{
+    ImU32           Key[2];
+    ImFontAtlasCacheHasher()                { Key[0] = 0; Key[1] = 0x9E3779B9; }
+    void            Add(const void* data, size_t data_size) { Key[0] = ImHashData(data, data_size, Key[0]); Key[1] = ImHashDataFast(data, data_size, Key[1]); }
+};
+
+// Hash all inputs of Build(). Fields are hashed individually to skip padding and pointers.
+static void ImFontAtlasCacheCalcKey(ImFontAtlas* atlas, ImU32 out_key[2])
+{
+    const int version_num = IMGUI_VERSION_NUM;
+    const int sizes[] = { (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCustomRect), IM_FONT_ATLAS_CACHE_VERSION };
+#ifdef IMGUI_ENABLE_FREETYPE
+    const int builder = atlas->FontBuilderIO ? 2 : 1;
+#else
+    const int builder = atlas->FontBuilderIO ? 2 : 0;
+#endif
+    ImFontAtlasCacheHasher hasher;
+    hasher.Add(&version_num, sizeof(version_num));
+    hasher.Add(sizes, sizeof(sizes));
+    hasher.Add(&builder, sizeof(builder));
+    hasher.Add(&atlas->FontBuilderFlags, sizeof(atlas->FontBuilderFlags));
+    hasher.Add(&atlas->Flags, sizeof(atlas->Flags));
+    hasher.Add(&atlas->TexDesiredWidth, sizeof(atlas->TexDesiredWidth));
+    hasher.Add(&atlas->TexGlyphPadding, sizeof(atlas->TexGlyphPadding));
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_n];
+        ImFontAtlasCacheConfig cache_cfg;
+        ImFontAtlasCacheInitConfig(atlas, cfg, &cache_cfg);
+        hasher.Add(&cache_cfg, sizeof(cache_cfg));
+
+        // Hashing font data is the most expensive part: the same font is commonly loaded multiple times at different sizes, so find a previous identical copy (memcmp() is much faster).
+        int same_data_cfg_n = -1;
+        for (int prev_cfg_n = 0; prev_cfg_n < cfg_n && same_data_cfg_n == -1; prev_cfg_n++)
+            if (atlas->ConfigData[prev_cfg_n].FontDataSize == cfg.FontDataSize && memcmp(atlas->ConfigData[prev_cfg_n].FontData, cfg.FontData, (size_t)cfg.FontDataSize) == 0)
+                same_data_cfg_n = prev_cfg_n;
+        if (same_data_cfg_n != -1)
+            hasher.Add(&same_data_cfg_n, sizeof(same_data_cfg_n));
+        else
+            hasher.Add(cfg.FontData, (size_t)cfg.FontDataSize);
+        int ranges_count;
+        const ImWchar* ranges = ImFontAtlasCacheGetGlyphRanges(atlas, cfg, &ranges_count);
+        hasher.Add(ranges, sizeof(ImWchar) * ranges_count);
+    }
+    for (const ImFontAtlasCustomRect& r : atlas->CustomRects)
+    {
+        const int font_index = atlas->Fonts.find_index(r.Font);
+        hasher.Add(&r.Width, sizeof(r.Width));
+        hasher.Add(&r.Height, sizeof(r.Height));
+        hasher.Add(&r.GlyphID, sizeof(r.GlyphID));
+        hasher.Add(&r.GlyphAdvanceX, sizeof(r.GlyphAdvanceX));
+        hasher.Add(&r.GlyphOffset, sizeof(r.GlyphOffset));
+        hasher.Add(&font_index, sizeof(font_index));
+    }
+    out_key[0] = hasher.Key[0];
+    out_key[1] = hasher.Key[1];
+}
+
+bool    ImFontAtlas::LoadCacheFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (data == NULL)
+        return false;
+    bool ret = LoadCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+bool    ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+
+    // Same setup as Build(), so the key matches the one computed in SaveCacheToFile()
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this);
+
+    // Validate
+    const char* p = (const char*)data;
+    const char* p_end = p + data_size;
+    ImFontAtlasCacheHeader header;
+    if (data_size < sizeof(header))
+        return false;
+    memcpy(&header, p, sizeof(header));
+    p += sizeof(header);
+    if (Flags & ImFontAtlasFlags_DynamicGlyphs)
+        return false; // Unsupported: dynamic glyphs need font data to be parsed by a builder
+    if (memcmp(header.Magic, "imfcache", 8) != 0 || header.Version != IM_FONT_ATLAS_CACHE_VERSION)
+        return false;
+    if (header.Flags != Flags || header.TexDesiredWidth != TexDesiredWidth || header.TexGlyphPadding != TexGlyphPadding || header.FontBuilderFlags != FontBuilderFlags)
+        return false;
+    if (header.ConfigsCount != ConfigData.Size || header.FontsCount != Fonts.Size || header.CustomRectsCount != CustomRects.Size || header.TexWidth <= 0 || header.TexHeight <= 0)
+        return false;
+    for (const ImFontConfig& cfg : ConfigData)
+    {
+        ImFontAtlasCacheConfig cache_cfg;
+        ImFontAtlasCacheInitConfig(this, cfg, &cache_cfg);
+        int ranges_count;
+        const ImWchar* ranges = ImFontAtlasCacheGetGlyphRanges(this, cfg, &ranges_count);
+        if ((size_t)(p_end - p) < sizeof(cache_cfg) + sizeof(ImWchar) * ranges_count)
+            return false;
+        if (memcmp(p, &cache_cfg, sizeof(cache_cfg)) != 0 || memcmp(p + sizeof(cache_cfg), ranges, sizeof(ImWchar) * ranges_count) != 0)
+            return false;
+        p += sizeof(cache_cfg) + sizeof(ImWchar) * ranges_count;
+    }
+    ImU32 key[2];
+    ImFontAtlasCacheCalcKey(this, key);
+    if (header.Key[0] != key[0] || header.Key[1] != key[1])
+        return false;
+    if ((size_t)(p_end - p) < sizeof(TexUvLines) + sizeof(ImU16) * 2 * CustomRects.Size)
+        return false;
+    const size_t pixels_size = (size_t)header.TexWidth * (size_t)header.TexHeight;
+    const char* p_fonts = p + sizeof(TexUvLines) + sizeof(ImU16) * 2 * CustomRects.Size;
+    const char* p_pixels = p_fonts;
+    for (int font_n = 0; font_n < header.FontsCount; font_n++)
+    {
+        ImFontAtlasCacheFont font_header;
+        if (p_pixels + sizeof(font_header) > p_end)
+            return false;
+        memcpy(&font_header, p_pixels, sizeof(font_header));
+        if (font_header.GlyphsCount <= 0 || (size_t)(p_end - p_pixels) < sizeof(font_header) + sizeof(ImFontGlyph) * font_header.GlyphsCount)
+            return false;
+        p_pixels += sizeof(font_header) + sizeof(ImFontGlyph) * font_header.GlyphsCount;
+    }
+    if ((size_t)(p_end - p_pixels) != pixels_size)
+        return false;
+
+    // Texture and custom rectangles
+    TexID = (ImTextureID)NULL;
+    ClearTexData();
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    memcpy(TexUvLines, p, sizeof(TexUvLines));
+    p += sizeof(TexUvLines);
+    for (ImFontAtlasCustomRect& r : CustomRects)
+    {
+        ImU16 xy[2];
+        memcpy(xy, p, sizeof(xy));
+        p += sizeof(xy);
+        r.X = xy[0];
+        r.Y = xy[1];
+    }
+    TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(pixels_size);
+    memcpy(TexPixelsAlpha8, p_pixels, pixels_size);
+
+    // Fonts: same setup as builders, then restore glyphs
+    IM_ASSERT(p == p_fonts);
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        ImFont* font = Fonts[font_n];
+        ImFontAtlasCacheFont font_header;
+        memcpy(&font_header, p, sizeof(font_header));
+        p += sizeof(font_header);
+        for (ImFontConfig& cfg : ConfigData)
+            if (cfg.DstFont == font)
+                ImFontAtlasBuildSetupFont(this, font, &cfg, font_header.Ascent, font_header.Descent);
+        font->Glyphs.resize(font_header.GlyphsCount);
+        memcpy(font->Glyphs.Data, p, sizeof(ImFontGlyph) * font_header.GlyphsCount);
+        p += sizeof(ImFontGlyph) * font_header.GlyphsCount;
+        font->MetricsTotalSurface = font_header.MetricsTotalSurface;
+        font->BuildLookupTable();
+    }
+    TexReady = true;
+    return true;
+}
+
+bool    ImFontAtlas::SaveCacheToFile(const char* filename)
+{
+    IM_ASSERT(IsBuilt() && "Call Build() before SaveCacheToFile()");
+    if (TexPixelsAlpha8 == NULL || TexPixelsUseColors)
+        return false; // Unsupported: colored glyphs are stored in RGBA32 only
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+
+    ImFontAtlasCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, "imfcache", 8);
+    header.Version = IM_FONT_ATLAS_CACHE_VERSION;
+    ImFontAtlasCacheCalcKey(this, header.Key);
+    header.Flags = Flags;
+    header.TexDesiredWidth = TexDesiredWidth;
+    header.TexGlyphPadding = TexGlyphPadding;
+    header.FontBuilderFlags = FontBuilderFlags;
+    header.ConfigsCount = ConfigData.Size;
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    header.FontsCount = Fonts.Size;
+    header.CustomRectsCount = CustomRects.Size;
+    bool ret = ImFileWrite(&header, sizeof(header), 1, f) == 1;
+    for (const ImFontConfig& cfg : ConfigData)
+    {
+        ImFontAtlasCacheConfig cache_cfg;
+        ImFontAtlasCacheInitConfig(this, cfg, &cache_cfg);
+        int ranges_count;
+        const ImWchar* ranges = ImFontAtlasCacheGetGlyphRanges(this, cfg, &ranges_count);
+        ret &= ImFileWrite(&cache_cfg, sizeof(cache_cfg), 1, f) == 1;
+        ret &= ImFileWrite(ranges, sizeof(ImWchar), (ImU64)ranges_count, f) == (ImU64)ranges_count;
+    }
+    ret &= ImFileWrite(TexUvLines, sizeof(TexUvLines), 1, f) == 1;
+    for (const ImFontAtlasCustomRect& r : CustomRects)
+    {
+        const ImU16 xy[2] = { r.X, r.Y };
+        ret &= ImFileWrite(xy, sizeof(xy), 1, f) == 1;
+    }
+    for (const ImFont* font : Fonts)
+    {
+        ImFontAtlasCacheFont font_header;
+        font_header.Ascent = font->Ascent;
+        font_header.Descent = font->Descent;
+        font_header.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_header.GlyphsCount = font->Glyphs.Size;
+        ret &= ImFileWrite(&font_header, sizeof(font_header), 1, f) == 1;
+        ret &= ImFileWrite(font->Glyphs.Data, sizeof(ImFontGlyph), (ImU64)font->Glyphs.Size, f) == (ImU64)font->Glyphs.Size;
+    }
+    ret &= ImFileWrite(TexPixelsAlpha8, (ImU64)TexWidth * TexHeight, 1, f) == 1;
+    ImFileClose(f);
+    return ret;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -2721,6 +3393,25 @@ void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsig
             *data = table[*data];
 }
 
+// Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs): state of one glyph in ImFont::Glyphs[]
+struct ImFontDynamicGlyphInfo
+{
+    int                 LastUsedFrame;      // Updated by FindGlyph()
+    int                 CellClass;          // Index into ImFontAtlasDynamicGlyphs::CellClasses[]. -1 for glyphs rasterized by Build(), which are never evicted.
+    int                 Cell;               // Index into ImFontDynamicCellClass::Cells[]
+};
+
+// Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs): state of one ImFont
+struct ImFontDynamicGlyphs
+{
+    int                                 FrameCount;     // Copy of ImFontAtlasDynamicGlyphs::FrameCount
+    int                                 Generation;     // Incremented when glyphs are loaded or evicted (see ImFontGetGlyphsGeneration())
+    ImVector<ImFontDynamicGlyphInfo>    GlyphsInfo;     // Parallel to ImFont::Glyphs[]
+    ImVector<ImWchar>                   Requests;       // Codepoints requested by FindGlyph() since last ImFontAtlasUpdateDynamicGlyphs()
+    ImVector<ImWchar>                   Used;           // Codepoints of evictable glyphs used by FindGlyph() for the first time in current frame, in order of use
+    ImBitVector                         Requested;      // Codepoints requested, loaded or known to be missing from font data. Cleared on eviction so they can be requested again.
+};
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
@@ -2747,6 +3438,54 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// A rasterization job: a range of glyphs from one source font (see ImFontAtlas::ParallelForFunc)
+struct ImFontBuildRasterJob
+{
+    int                 SrcIndex;
+    int                 GlyphStart;
+    int                 GlyphCount;
+};
+
+struct ImFontBuildRasterJobs
+{
+    ImFontAtlas*                    Atlas;
+    ImFontBuildSrcData*             SrcData;
+    const stbtt_pack_context*       PackContext;
+    ImFontBuildJobAllocator*        Allocator;      // NULL when running single-threaded
+    ImVector<ImFontBuildRasterJob>  Jobs;
+};
+
+// Render glyphs of a job into their own packed rectangles, then apply multiply operator.
+// Jobs write into distinct rectangles of the texture and into distinct stbtt_packedchar entries, so they may run concurrently.
+static void ImFontAtlasBuildRasterJobFunc(void* job_data, int job_index)
+{
+    ImFontBuildRasterJobs* jobs = (ImFontBuildRasterJobs*)job_data;
+    const ImFontBuildRasterJob& job = jobs->Jobs[job_index];
+    const ImFontConfig& cfg = jobs->Atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = jobs->SrcData[job.SrcIndex];
+
+    stbtt_pack_context spc = *jobs->PackContext;        // stbtt_PackFontRangesRenderIntoRects() temporarily modifies the context
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs->Allocator;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphStart;
+    pack_range.chardata_for_range += job.GlyphStart;
+    pack_range.num_chars = job.GlyphCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, jobs->Atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, jobs->Atlas->TexWidth * 1);
+    }
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2759,6 +3498,8 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+static void ImFontAtlasBuildDynamicGlyphsInit(ImFontAtlas* atlas, const ImFontBuildSrcData* src_tmp_array, int free_space_y);
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2916,6 +3657,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexHeight = 0;
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
+    else if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : 1024;
     else
         atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
 
@@ -2943,6 +3686,10 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+    // With ImFontAtlasFlags_DynamicGlyphs, reserve free space below packed glyphs for glyphs rasterized on demand.
+    const int packed_height = atlas->TexHeight;
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        atlas->TexHeight = ImMax(atlas->TexHeight * 2, atlas->TexWidth);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -2951,27 +3698,33 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // When a ParallelForFunc is provided, split glyphs into small jobs which may run on multiple threads.
+    // Packing is already done, so every glyph renders into its own rectangle and the output is identical.
+    ImFontBuildJobAllocator job_allocator;
+    ImGui::GetAllocatorFunctions(&job_allocator.AllocFunc, &job_allocator.FreeFunc, &job_allocator.UserData);
+    ImFontBuildRasterJobs raster_jobs;
+    raster_jobs.Atlas = atlas;
+    raster_jobs.SrcData = src_tmp_array.Data;
+    raster_jobs.PackContext = &spc;
+    raster_jobs.Allocator = atlas->ParallelForFunc ? &job_allocator : NULL;
+    const int glyphs_per_job = atlas->ParallelForFunc ? 32 : INT_MAX;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_start = 0; glyph_start < src_tmp_array[src_i].GlyphsCount; glyph_start += glyphs_per_job)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRasterJob job;
+            job.SrcIndex = src_i;
+            job.GlyphStart = glyph_start;
+            job.GlyphCount = ImMin(glyphs_per_job, src_tmp_array[src_i].GlyphsCount - glyph_start);
+            raster_jobs.Jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
-    }
+    if (atlas->ParallelForFunc && raster_jobs.Jobs.Size > 1)
+        atlas->ParallelForFunc(ImFontAtlasBuildRasterJobFunc, &raster_jobs, raster_jobs.Jobs.Size, atlas->ParallelForUserData);
+    else
+        for (int job_i = 0; job_i < raster_jobs.Jobs.Size; job_i++)
+            ImFontAtlasBuildRasterJobFunc(&raster_jobs, job_i);
+    raster_jobs.Jobs.clear();
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -3015,10 +3768,12 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    ImFontAtlasBuildFinish(atlas);
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        ImFontAtlasBuildDynamicGlyphsInit(atlas, src_tmp_array.Data, packed_height + atlas->TexGlyphPadding);
+
     // Cleanup
     src_tmp_array.clear_destruct();
-
-    ImFontAtlasBuildFinish(atlas);
     return true;
 }
 
@@ -3029,6 +3784,440 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+//-----------------------------------------------------------------------------
+// Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs)
+//-----------------------------------------------------------------------------
+// - Build() rasterizes requested GlyphRanges as usual, then keeps the stb_truetype font info of each source font.
+// - ImFont::FindGlyph() queues codepoints missing from a font, and stamps the frame at which existing glyphs are used.
+// - ImFontAtlasUpdateDynamicGlyphs(), called by NewFrame(), rasterizes queued glyphs from the first source font
+//   which has them, into the free space below packed glyphs, and extends TexDirtyRect for the backend to upload it.
+// - Free space is split into cells: width is rounded up to a multiple of 16, height is the line height of the source font
+//   (or rounded up to a multiple of 16 for taller glyphs). Cells of a same size are allocated one row (shelf) at a time.
+//   When no space is left, we use a free cell of a larger size, or evict the least recently used glyph of the same size
+//   (or of a larger size if older), unless it was used in the last frame (in which case we try again on a later frame).
+// - Cells holding a glyph are linked in least recently used order for each cell size. FindGlyph() records glyphs used
+//   for the first time in a frame, which ImFontAtlasUpdateDynamicGlyphs() moves to the end of their list: eviction is O(1).
+// - Glyphs rasterized by Build() are never evicted. Evicted glyphs keep their IndexAdvanceX[] entry so layout is stable.
+//-----------------------------------------------------------------------------
+
+struct ImFontDynamicSrc
+{
+    stbtt_fontinfo      FontInfo;
+    int                 CellHeight;         // Default cell height, from font ascent/descent
+};
+
+// Cell of a cell class, linked with other cells of the class holding a glyph in least recently used order
+struct ImFontDynamicCell
+{
+    ImU16               X, Y;
+    int                 Prev, Next;         // Index into ImFontDynamicCellClass::Cells[], -1 if none
+    int                 FontN;              // Index into ImFontAtlas::Fonts[] of glyph in this cell, -1 if free
+    ImWchar             Codepoint;
+};
+
+// Cells of a given size
+struct ImFontDynamicCellClass
+{
+    int                         Width, Height;
+    ImVector<ImFontDynamicCell> Cells;
+    ImVector<int>               FreeCells;  // Index into Cells[]
+    int                         LruHead;    // Cell of least recently used glyph, -1 if none
+    int                         LruTail;    // Cell of most recently used glyph, -1 if none
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    int                                 FrameCount;
+    int                                 ShelfStartY;    // First row of free space below glyphs rasterized by Build()
+    int                                 ShelfNextY;     // Next free row of texture
+    ImVector<ImFontDynamicSrc>          Srcs;           // Parallel to ImFontAtlas::ConfigData[]
+    ImVector<ImFontDynamicCellClass>    CellClasses;
+    ImVector<ImFontDynamicGlyphs>       Fonts;          // Parallel to ImFontAtlas::Fonts[]
+    int                                 LoadedCount;    // Stats
+    int                                 EvictedCount;   // Stats
+};
+
+static void ImFontAtlasBuildDynamicGlyphsInit(ImFontAtlas* atlas, const ImFontBuildSrcData* src_tmp_array, int free_space_y)
+{
+    ImFontAtlasDynamicGlyphs* dyn = IM_NEW(ImFontAtlasDynamicGlyphs)();
+    dyn->FrameCount = 0;
+    dyn->ShelfStartY = dyn->ShelfNextY = free_space_y;
+    dyn->LoadedCount = dyn->EvictedCount = 0;
+    atlas->DynamicGlyphs = dyn;
+
+    // Calculate default cell height for each source font
+    dyn->Srcs.resize(atlas->ConfigData.Size);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        ImFontDynamicSrc& src = dyn->Srcs[src_i];
+        src.FontInfo = src_tmp_array[src_i].FontInfo;
+        const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+        int unscaled_ascent, unscaled_descent, unscaled_line_gap;
+        stbtt_GetFontVMetrics(&src.FontInfo, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
+        src.CellHeight = (int)ImCeil((unscaled_ascent - unscaled_descent) * scale * cfg.OversampleV) + 2 + atlas->TexGlyphPadding + cfg.OversampleV - 1;
+    }
+
+    // Glyphs rasterized by Build() are never evicted
+    dyn->Fonts.resize(atlas->Fonts.Size);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        ImFontDynamicGlyphs* font_dyn = IM_PLACEMENT_NEW(&dyn->Fonts[font_n]) ImFontDynamicGlyphs();
+        font_dyn->FrameCount = 0;
+        font_dyn->Generation = 0;
+        font_dyn->GlyphsInfo.resize(font->Glyphs.Size);
+        for (ImFontDynamicGlyphInfo& glyph_info : font_dyn->GlyphsInfo)
+        {
+            glyph_info.LastUsedFrame = 0;
+            glyph_info.CellClass = -1;
+            glyph_info.Cell = -1;
+        }
+        font_dyn->Requested.Create(IM_UNICODE_CODEPOINT_MAX + 1);
+        for (const ImFontGlyph& glyph : font->Glyphs)
+            font_dyn->Requested.SetBit((int)glyph.Codepoint);
+        font->DynamicGlyphs = font_dyn;
+    }
+}
+
+void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    if (dyn == NULL)
+        return;
+    for (ImFont* font : atlas->Fonts)
+        font->DynamicGlyphs = NULL;
+    dyn->Fonts.clear_destruct();
+    dyn->CellClasses.clear_destruct();
+    IM_DELETE(dyn);
+    atlas->DynamicGlyphs = NULL;
+    atlas->ClearTexDirty();
+}
+
+// Update TexDirtyRect and RGBA32 copy of texture if any
+static void ImFontAtlasDynamicGlyphsMarkDirty(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    if (atlas->TexPixelsRGBA32)
+        for (int yy = y; yy < y + h; yy++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + yy * atlas->TexWidth + x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + yy * atlas->TexWidth + x;
+            for (int n = w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    const ImVec4 r((float)x, (float)y, (float)(x + w), (float)(y + h));
+    if (atlas->IsTexDirty())
+        atlas->TexDirtyRect = ImVec4(ImMin(atlas->TexDirtyRect.x, r.x), ImMin(atlas->TexDirtyRect.y, r.y), ImMax(atlas->TexDirtyRect.z, r.z), ImMax(atlas->TexDirtyRect.w, r.w));
+    else
+        atlas->TexDirtyRect = r;
+}
+
+// Return -1 if glyph is too large for free space
+static int ImFontAtlasDynamicGlyphsGetCellClass(ImFontAtlas* atlas, const ImFontDynamicSrc& src, int w, int h)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    const int cell_w = IM_MEMALIGN(w, 16);
+    const int cell_h = (h <= src.CellHeight) ? src.CellHeight : IM_MEMALIGN(h, 16);
+    if (cell_w > atlas->TexWidth || cell_h > atlas->TexHeight - dyn->ShelfStartY)
+        return -1;
+    for (int n = 0; n < dyn->CellClasses.Size; n++)
+        if (dyn->CellClasses[n].Width == cell_w && dyn->CellClasses[n].Height == cell_h)
+            return n;
+    dyn->CellClasses.push_back(ImFontDynamicCellClass());
+    ImFontDynamicCellClass* cell_class = &dyn->CellClasses.back();
+    cell_class->Width = cell_w;
+    cell_class->Height = cell_h;
+    cell_class->LruHead = cell_class->LruTail = -1;
+    return dyn->CellClasses.Size - 1;
+}
+
+static void ImFontDynamicCellClassUnlink(ImFontDynamicCellClass* cell_class, int cell_n)
+{
+    ImFontDynamicCell& cell = cell_class->Cells[cell_n];
+    if (cell.Prev != -1)
+        cell_class->Cells[cell.Prev].Next = cell.Next;
+    else
+        cell_class->LruHead = cell.Next;
+    if (cell.Next != -1)
+        cell_class->Cells[cell.Next].Prev = cell.Prev;
+    else
+        cell_class->LruTail = cell.Prev;
+    cell.Prev = cell.Next = -1;
+}
+
+static void ImFontDynamicCellClassLinkTail(ImFontDynamicCellClass* cell_class, int cell_n)
+{
+    ImFontDynamicCell& cell = cell_class->Cells[cell_n];
+    cell.Prev = cell_class->LruTail;
+    cell.Next = -1;
+    if (cell_class->LruTail != -1)
+        cell_class->Cells[cell_class->LruTail].Next = cell_n;
+    else
+        cell_class->LruHead = cell_n;
+    cell_class->LruTail = cell_n;
+}
+
+// Return frame at which least recently used glyph of a cell class was used, INT_MAX if none
+static int ImFontAtlasDynamicGlyphsGetLruFrame(ImFontAtlas* atlas, const ImFontDynamicCellClass& cell_class)
+{
+    if (cell_class.LruHead == -1)
+        return INT_MAX;
+    const ImFontDynamicCell& cell = cell_class.Cells[cell_class.LruHead];
+    const ImFont* font = atlas->Fonts[cell.FontN];
+    return font->DynamicGlyphs->GlyphsInfo[font->IndexLookup[cell.Codepoint]].LastUsedFrame;
+}
+
+// Evict least recently used glyph of a cell class, returning its cell to the free list.
+static void ImFontAtlasDynamicGlyphsEvictOne(ImFontAtlas* atlas, int cell_class_n)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    ImFontDynamicCellClass* cell_class = &dyn->CellClasses[cell_class_n];
+    const int cell_n = cell_class->LruHead;
+    IM_ASSERT(cell_n != -1);
+    ImFontDynamicCell& cell = cell_class->Cells[cell_n];
+    ImFont* font = atlas->Fonts[cell.FontN];
+    const int codepoint = (int)cell.Codepoint;
+    ImFontDynamicCellClassUnlink(cell_class, cell_n);
+    cell.FontN = -1;
+    cell_class->FreeCells.push_back(cell_n);
+
+    // Remove glyph, moving last glyph in its place. Glyphs rasterized by Build() are first in the array so this never moves them.
+    ImFontDynamicGlyphs* font_dyn = font->DynamicGlyphs;
+    const int glyph_n = (int)font->IndexLookup[codepoint];
+    font->IndexLookup[codepoint] = (ImWchar)-1;
+    font_dyn->Requested.ClearBit(codepoint);
+    const int last_glyph_n = font->Glyphs.Size - 1;
+    if (glyph_n != last_glyph_n)
+    {
+        font->Glyphs[glyph_n] = font->Glyphs[last_glyph_n];
+        font_dyn->GlyphsInfo[glyph_n] = font_dyn->GlyphsInfo[last_glyph_n];
+        font->IndexLookup[font->Glyphs[glyph_n].Codepoint] = (ImWchar)glyph_n;
+    }
+    font->Glyphs.pop_back();
+    font_dyn->GlyphsInfo.pop_back();
+    font_dyn->Generation++;
+    dyn->EvictedCount++;
+}
+
+// Allocate a cell for a glyph of size (w, h) and cell class 'cell_class_n', in this order:
+// - a free cell of the cell class, or of a new row of cells if there is free space left.
+// - a free cell of the smallest larger cell class.
+// - the cell of the least recently used glyph of the cell class, or of a larger cell class if it was used earlier.
+//   Glyphs used in last frame are not evicted: return false, we'll try again on a later frame.
+static bool ImFontAtlasDynamicGlyphsAllocCell(ImFontAtlas* atlas, int cell_class_n, int w, int h, int* out_cell_class_n, int* out_cell_n)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    ImFontDynamicCellClass* cell_class = &dyn->CellClasses[cell_class_n];
+    if (cell_class->FreeCells.Size == 0 && dyn->ShelfNextY + cell_class->Height <= atlas->TexHeight)
+    {
+        for (int cell_x = (atlas->TexWidth / cell_class->Width - 1) * cell_class->Width; cell_x >= 0; cell_x -= cell_class->Width)
+        {
+            ImFontDynamicCell cell;
+            cell.X = (ImU16)cell_x;
+            cell.Y = (ImU16)dyn->ShelfNextY;
+            cell.Prev = cell.Next = cell.FontN = -1;
+            cell.Codepoint = 0;
+            cell_class->FreeCells.push_back(cell_class->Cells.Size);
+            cell_class->Cells.push_back(cell);
+        }
+        dyn->ShelfNextY += cell_class->Height;
+    }
+
+    int best_cell_class_n = (cell_class->FreeCells.Size > 0) ? cell_class_n : -1;
+    if (best_cell_class_n == -1)
+        for (int n = 0; n < dyn->CellClasses.Size; n++)
+        {
+            const ImFontDynamicCellClass& other = dyn->CellClasses[n];
+            if (other.FreeCells.Size > 0 && other.Width >= w && other.Height >= h)
+                if (best_cell_class_n == -1 || other.Width * other.Height < dyn->CellClasses[best_cell_class_n].Width * dyn->CellClasses[best_cell_class_n].Height)
+                    best_cell_class_n = n;
+        }
+    if (best_cell_class_n == -1)
+    {
+        // Own cell class first, so it wins ties
+        int best_last_used_frame = dyn->FrameCount - 1; // Don't evict glyphs used in last frame
+        for (int n = -1; n < dyn->CellClasses.Size; n++)
+        {
+            const int other_n = (n == -1) ? cell_class_n : n;
+            const ImFontDynamicCellClass& other = dyn->CellClasses[other_n];
+            if ((n != -1 && other_n == cell_class_n) || other.Width < w || other.Height < h)
+                continue;
+            const int last_used_frame = ImFontAtlasDynamicGlyphsGetLruFrame(atlas, other);
+            if (last_used_frame < best_last_used_frame)
+            {
+                best_cell_class_n = other_n;
+                best_last_used_frame = last_used_frame;
+            }
+        }
+        if (best_cell_class_n == -1)
+            return false;
+        ImFontAtlasDynamicGlyphsEvictOne(atlas, best_cell_class_n);
+    }
+
+    ImFontDynamicCellClass& best_cell_class = dyn->CellClasses[best_cell_class_n];
+    *out_cell_class_n = best_cell_class_n;
+    *out_cell_n = best_cell_class.FreeCells.back();
+    best_cell_class.FreeCells.pop_back();
+    return true;
+}
+
+// Return false if we ran out of space, so it can be requested again later.
+static bool ImFontAtlasDynamicGlyphsLoad(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    ImFontDynamicGlyphs* font_dyn = font->DynamicGlyphs;
+
+    // Find first source font which has the glyph
+    int src_i = -1;
+    int glyph_index_in_font = 0;
+    for (int n = 0; n < atlas->ConfigData.Size && src_i == -1; n++)
+        if (atlas->ConfigData[n].DstFont == font && (glyph_index_in_font = stbtt_FindGlyphIndex(&dyn->Srcs[n].FontInfo, codepoint)) != 0)
+            src_i = n;
+    if (src_i == -1 || font->Glyphs.Size >= 0xFFFE)
+        return true; // Not in font data: don't request again
+    ImFontConfig& cfg = atlas->ConfigData[src_i];
+    ImFontDynamicSrc& src = dyn->Srcs[src_i];
+    IM_ASSERT(cfg.FontData != NULL && "ImFontAtlasFlags_DynamicGlyphs needs font data: don't call ClearInputData()!");
+
+    // Measure glyph (same as ImFontAtlasBuildWithStbTruetype())
+    const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(&src.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect rect = {};
+    rect.w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + cfg.OversampleH - 1);
+    rect.h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + cfg.OversampleV - 1);
+    const int cell_class_n = ImFontAtlasDynamicGlyphsGetCellClass(atlas, src, rect.w, rect.h);
+    if (cell_class_n == -1)
+        return true; // Too large for free space: don't request again
+
+    // Allocate cell (possibly evicting a glyph)
+    int cell_n;
+    int alloc_cell_class_n;
+    if (!ImFontAtlasDynamicGlyphsAllocCell(atlas, cell_class_n, rect.w, rect.h, &alloc_cell_class_n, &cell_n))
+        return false;
+    ImFontDynamicCellClass& cell_class = dyn->CellClasses[alloc_cell_class_n];
+    const int cell_x = cell_class.Cells[cell_n].X;
+    const int cell_y = cell_class.Cells[cell_n].Y;
+
+    // Clear cell and rasterize
+    for (int y = cell_y; y < cell_y + cell_class.Height; y++)
+        memset(atlas->TexPixelsAlpha8 + y * atlas->TexWidth + cell_x, 0, (size_t)cell_class.Width);
+    int codepoint_int = (int)codepoint;
+    stbtt_packedchar pc = {};
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels * cfg.RasterizerDensity;
+    pack_range.array_of_unicode_codepoints = &codepoint_int;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &pc;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_pack_context spc = {};
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = atlas->TexGlyphPadding;
+    spc.h_oversample = spc.v_oversample = 1;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    rect.x = (stbrp_coord)cell_x;
+    rect.y = (stbrp_coord)cell_y;
+    rect.was_packed = 1;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src.FontInfo, &pack_range, 1, &rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+    }
+    ImFontAtlasDynamicGlyphsMarkDirty(atlas, cell_x, cell_y, cell_class.Width, cell_class.Height);
+
+    // Register glyph (same as ImFontAtlasBuildWithStbTruetype())
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent);
+    const float inv_rasterization_scale = 1.0f / cfg.RasterizerDensity;
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    const int fallback_glyph_n = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+    font->AddGlyph(&cfg, codepoint, q.x0 * inv_rasterization_scale + font_off_x, q.y0 * inv_rasterization_scale + font_off_y, q.x1 * inv_rasterization_scale + font_off_x, q.y1 * inv_rasterization_scale + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
+    if (fallback_glyph_n != -1)
+        font->FallbackGlyph = &font->Glyphs[fallback_glyph_n]; // Glyphs[] may have been reallocated
+
+    // Update lookup tables without rebuilding them
+    const ImFontGlyph& glyph = font->Glyphs.back();
+    if ((int)codepoint >= font->IndexLookup.Size)
+    {
+        const int old_size = font->IndexLookup.Size;
+        font->GrowIndex((int)codepoint + 1);
+        for (int n = old_size; n < font->IndexAdvanceX.Size; n++)
+            font->IndexAdvanceX[n] = font->FallbackAdvanceX;
+    }
+    font->IndexAdvanceX[codepoint] = glyph.AdvanceX;
+    font->IndexLookup[codepoint] = (ImWchar)(font->Glyphs.Size - 1);
+    font->Used4kPagesMap[(codepoint / 4096) >> 3] |= 1 << ((codepoint / 4096) & 7);
+    font->DirtyLookupTables = false;
+
+    ImFontDynamicCell& cell = cell_class.Cells[cell_n];
+    cell.FontN = (int)(font_dyn - dyn->Fonts.Data);
+    cell.Codepoint = codepoint;
+    ImFontDynamicCellClassLinkTail(&cell_class, cell_n);
+    ImFontDynamicGlyphInfo glyph_info;
+    glyph_info.LastUsedFrame = dyn->FrameCount;
+    glyph_info.CellClass = alloc_cell_class_n;
+    glyph_info.Cell = cell_n;
+    font_dyn->GlyphsInfo.push_back(glyph_info);
+    font_dyn->Generation++;
+    dyn->LoadedCount++;
+    return true;
+}
+
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    IM_ASSERT(dyn != NULL && !atlas->Locked);
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL && "ImFontAtlasFlags_DynamicGlyphs needs texture data: don't call ClearTexData()!");
+    dyn->FrameCount++;
+
+    // Move glyphs used in last frame to the end of their least recently used list
+    for (ImFont* font : atlas->Fonts)
+    {
+        ImFontDynamicGlyphs* font_dyn = font->DynamicGlyphs;
+        font_dyn->FrameCount = dyn->FrameCount;
+        for (ImWchar codepoint : font_dyn->Used)
+        {
+            const ImFontDynamicGlyphInfo& glyph_info = font_dyn->GlyphsInfo[font->IndexLookup[codepoint]];
+            ImFontDynamicCellClass* cell_class = &dyn->CellClasses[glyph_info.CellClass];
+            ImFontDynamicCellClassUnlink(cell_class, glyph_info.Cell);
+            ImFontDynamicCellClassLinkTail(cell_class, glyph_info.Cell);
+        }
+        font_dyn->Used.resize(0);
+    }
+
+    for (ImFont* font : atlas->Fonts)
+    {
+        ImFontDynamicGlyphs* font_dyn = font->DynamicGlyphs;
+        for (ImWchar codepoint : font_dyn->Requests)
+            if (!ImFontAtlasDynamicGlyphsLoad(atlas, font, codepoint))
+                font_dyn->Requested.ClearBit(codepoint);
+        font_dyn->Requests.resize(0);
+    }
+}
+
+bool ImFontAtlasHasDynamicGlyphRequests(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicGlyphs == NULL)
+        return false;
+    for (ImFont* font : atlas->Fonts)
+        if (font->DynamicGlyphs->Requests.Size > 0)
+            return true;
+    return false;
+}
+
+#else
+
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas*) {}
+bool ImFontAtlasHasDynamicGlyphRequests(ImFontAtlas*) { return false; }
+void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas*) {}
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasUpdateConfigDataPointers(ImFontAtlas* atlas)
@@ -3577,6 +4766,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    DynamicGlyphs = NULL;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3784,13 +4974,45 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
 }
 
+// ImFontAtlasFlags_DynamicGlyphs: queue request for ImFontAtlasUpdateDynamicGlyphs(). Glyph will be available on next frame.
+static const ImFontGlyph* ImFontRequestDynamicGlyph(ImFontDynamicGlyphs* font_dyn, const ImFontGlyph* fallback_glyph, ImWchar c)
+{
+    if (!font_dyn->Requested.TestBit(c))
+    {
+        font_dyn->Requested.SetBit(c);
+        font_dyn->Requests.push_back(c);
+    }
+    return fallback_glyph;
+}
+
+// ImFontAtlasFlags_DynamicGlyphs: record first use of a glyph in current frame, to maintain least recently used order.
+static inline void ImFontTouchDynamicGlyph(ImFontDynamicGlyphs* font_dyn, int glyph_n, ImWchar c)
+{
+    ImFontDynamicGlyphInfo& glyph_info = font_dyn->GlyphsInfo.Data[glyph_n];
+    if (glyph_info.LastUsedFrame == font_dyn->FrameCount)
+        return;
+    glyph_info.LastUsedFrame = font_dyn->FrameCount;
+    if (glyph_info.CellClass != -1)
+        font_dyn->Used.push_back(c);
+}
+
+// Glyphs of fonts using ImFontAtlasFlags_DynamicGlyphs may be added, moved or evicted by ImFontAtlasUpdateDynamicGlyphs().
+// Compare this value to detect when stored glyph pointers or measurements need to be recomputed.
+int ImFontGetGlyphsGeneration(const ImFont* font)
+{
+    return font->DynamicGlyphs ? font->DynamicGlyphs->Generation : 0;
+}
+
+// With ImFontAtlasFlags_DynamicGlyphs, this modifies the mutable DynamicGlyphs state (not thread-safe): only call from the thread calling NewFrame().
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
     if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
+        return DynamicGlyphs ? ImFontRequestDynamicGlyph(DynamicGlyphs, FallbackGlyph, c) : FallbackGlyph;
     const ImWchar i = IndexLookup.Data[c];
     if (i == (ImWchar)-1)
-        return FallbackGlyph;
+        return DynamicGlyphs ? ImFontRequestDynamicGlyph(DynamicGlyphs, FallbackGlyph, c) : FallbackGlyph;
+    if (DynamicGlyphs)
+        ImFontTouchDynamicGlyph(DynamicGlyphs, i, c);
     return &Glyphs.Data[i];
 }
 
@@ -4008,7 +5230,6 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
-// Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
     if (!text_end)
@@ -4195,6 +5416,147 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->_VtxCurrentIdx = vtx_index;
 }
 
+// Text layout cache helpers (see io.ConfigTextLayoutCache)
+// - ImFontCalcTextLayout() runs the same layout as ImFont::RenderText(), without clipping, and stores visible glyphs.
+// - ImFontRenderTextLayout() is equivalent to ImDrawList::AddText() without CPU fine clipping, but skips UTF-8 decoding,
+//   glyph lookups and word-wrapping by reading the stored glyphs. With dynamic glyphs, it records glyph usage like FindGlyph()
+//   would, so glyphs only rendered from the cache are not evicted. Stored glyphs are valid for one ImFontGetGlyphsGeneration().
+void ImFontCalcTextLayout(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<ImGuiTextLayoutGlyph>* out_glyphs)
+{
+    out_glyphs->resize(0);
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - x);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+        if (glyph->Visible)
+        {
+            ImGuiTextLayoutGlyph layout_glyph;
+            layout_glyph.Glyph = glyph;
+            layout_glyph.X = x;
+            layout_glyph.Y = y;
+            out_glyphs->push_back(layout_glyph);
+        }
+        x += glyph->AdvanceX * scale;
+    }
+}
+
+void ImFontRenderTextLayout(const ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImGuiTextLayout* layout)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    IM_ASSERT(font->ContainerAtlas->TexID == draw_list->_CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    const ImVec4 clip_rect = draw_list->_CmdHeader.ClipRect;
+
+    // Align to be pixel perfect
+    const float x = IM_TRUNC(pos.x);
+    const float y = IM_TRUNC(pos.y);
+    if (y > clip_rect.w)
+        return;
+
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+
+    // Skip lines above clipping rectangle
+    const ImGuiTextLayoutGlyph* layout_glyph = layout->Glyphs.Data;
+    const ImGuiTextLayoutGlyph* layout_glyph_end = layout->Glyphs.Data + layout->Glyphs.Size;
+    while (layout_glyph < layout_glyph_end && y + layout_glyph->Y + line_height < clip_rect.y)
+        layout_glyph++;
+    if (layout_glyph == layout_glyph_end)
+        return;
+
+    const int vtx_count_max = (int)(layout_glyph_end - layout_glyph) * 4;
+    const int idx_count_max = (int)(layout_glyph_end - layout_glyph) * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    ImFontDynamicGlyphs* font_dyn = font->DynamicGlyphs;
+    for (; layout_glyph < layout_glyph_end; layout_glyph++)
+    {
+        const ImFontGlyph* glyph = layout_glyph->Glyph;
+        if (font_dyn)
+            ImFontTouchDynamicGlyph(font_dyn, (int)(glyph - font->Glyphs.Data), (ImWchar)glyph->Codepoint);
+        const float glyph_x = x + layout_glyph->X;
+        const float glyph_y = y + layout_glyph->Y;
+        if (glyph_y > clip_rect.w)
+            break;
+        const float x1 = glyph_x + glyph->X0 * scale;
+        const float x2 = glyph_x + glyph->X1 * scale;
+        if (x1 > clip_rect.z || x2 < clip_rect.x)
+            continue;
+        const float y1 = glyph_y + glyph->Y0 * scale;
+        const float y2 = glyph_y + glyph->Y1 * scale;
+        const float u1 = glyph->U0;
+        const float v1 = glyph->V0;
+        const float u2 = glyph->U1;
+        const float v2 = glyph->V1;
+        ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+
+    // Give back unused vertices (clipped ones)
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui Internal Render Helpers
 //-----------------------------------------------------------------------------
@@ -60,6 +60,9 @@ Index of this file:
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
 #endif
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -128,6 +131,7 @@ struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataVarInfo;            // Variable information (e.g. to access style variables from an enum)
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
+struct ImGuiClipGroupData;          // Storage data for BeginClipGroup()/EndClipGroup()
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
@@ -154,6 +158,7 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextLayout;             // Cached size and glyphs of a text (see io.ConfigTextLayoutCache)
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
@@ -347,6 +352,7 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImArenaAllocator
 // - Helper: ImGuiTextIndex
 // - Helper: ImGuiStorage
 //-----------------------------------------------------------------------------
@@ -354,6 +360,7 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImU32         ImHashDataFast(const void* data, size_t data_size, ImU32 seed = 0); // Same as ImHashData() with IMGUI_USE_FAST_HASH. For keys which are never stored.
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -723,6 +730,35 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
+// Helper: ImArenaAllocator
+// Linear (bump) allocator for transient data: allocations are never freed individually, Reset() releases all of them at once.
+// - Blocks are allocated with IM_ALLOC() and kept across Reset() calls. If more than one block was needed, Reset() replaces them
+//   with a single block large enough for the previous usage, so a repeating workload stops touching the heap after a frame or two.
+// - The main block is shrunk when it stayed 4 times larger than needed for DecayResetCount calls to Reset(), so a one-off
+//   spike (e.g. pasting a large text) doesn't keep memory reserved for the lifetime of the context.
+// - The context owns one in g.FrameArena, which is reset by NewFrame(). Use ImGui::MemAllocFrame() to allocate from it.
+struct ImArenaAllocator
+{
+    ImVector<void*> Blocks;             // Blocks[0] is the main block. Additional blocks are overflow blocks allocated since the last Reset().
+    size_t          MainBlockSize;      // Size of Blocks[0]
+    size_t          CurrBlockSize;      // Size of Blocks.back()
+    size_t          CurrBlockOffset;    // Offset of next allocation in Blocks.back()
+    size_t          UsedBytes;          // Bytes allocated since last Reset() (including alignment padding)
+    int             UsedCount;          // Number of allocations since last Reset()
+    size_t          PeakUsedBytes;
+    size_t          RecentPeakUsedBytes;// Max of UsedBytes over the last RecentResetCount calls to Reset()
+    int             RecentResetCount;
+    size_t          ReservedBytes;      // Sum of block sizes
+    int             DecayResetCount;    // = 300 // Number of calls to Reset() before shrinking an oversized main block.
+
+    ImArenaAllocator()                  { memset(this, 0, sizeof(*this)); DecayResetCount = 300; }
+
+    ~ImArenaAllocator()                 { Clear(); }
+    IMGUI_API void* Alloc(size_t size); // Returned memory is aligned to 16 bytes
+    IMGUI_API void  Reset();            // Release all allocations, keep memory
+    IMGUI_API void  Clear();            // Release all allocations and memory
+};
+
 // Helper: ImGuiTextIndex
 // Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
 struct ImGuiTextIndex
@@ -770,6 +806,18 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
+// Threading: ImDrawList instances may be filled concurrently on different threads, then appended into a window
+// or foreground draw list with ImDrawList::AppendDrawList(), or added with ImDrawData::AddDrawList() after Render().
+// - All fields are written by NewFrame() and may be read concurrently until the next NewFrame():
+//   worker threads must start after NewFrame() and be done before the next NewFrame().
+// - Font/FontSize are also written by PushFont()/PopFont(): workers must use the AddText() overload taking an explicit font.
+// - ImFont data is read-only, unless using ImFontAtlasFlags_DynamicGlyphs: FindGlyph() then records glyph usage,
+//   so text must be output on the main thread.
+// - Each draw list must only be used by one thread at a time. Call _ResetForNewFrame() before filling a draw list
+//   you created, followed by PushTextureID() and PushClipRect()/PushClipRectFullScreen().
+// - Growing draw list buffers calls ImGui::MemAlloc(), which updates debug counters of the current context.
+//   Those are not thread-safe: define GImGui as a thread-local variable (see comments about GImGui in imgui.cpp)
+//   so worker threads have no current context, or disable the counters with IMGUI_DISABLE_DEBUG_TOOLS.
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas
@@ -780,9 +828,6 @@ struct IMGUI_API ImDrawListSharedData
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
 
-    // [Internal] Temp write buffer
-    ImVector<ImVec2> TempBuffer;
-
     // [Internal] Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
@@ -801,6 +846,33 @@ struct ImDrawDataBuilder
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// Visible glyph of a ImGuiTextLayout. Position of the glyph origin, relative to text position, font scale applied.
+struct ImGuiTextLayoutGlyph
+{
+    const ImFontGlyph*  Glyph;
+    float               X, Y;
+};
+
+// Cached size and glyphs of a text, keyed by font, size, wrap width and contents (see io.ConfigTextLayoutCache)
+// Stored in g.TextLayoutCache. Entries not used for a few frames are discarded, entries are reinitialized when font glyphs change.
+struct IMGUI_API ImGuiTextLayout
+{
+    ImGuiID                 Key;
+    int                     LastFrameUsed;
+    const ImFont*           Font;
+    float                   FontSize;
+    float                   WrapWidth;          // 0.0f for text without word-wrapping
+    const ImFontGlyph*      FontGlyphs;         // Copy of Font->Glyphs.Data, to detect glyph pointers getting invalidated
+    int                     FontGlyphsGeneration; // Copy of ImFontGetGlyphsGeneration(Font), to detect glyphs loaded or evicted with ImFontAtlasFlags_DynamicGlyphs
+    ImVector<char>          Text;               // Copy of text (without zero-terminator), to rule out hash collisions
+    ImVec2                  Size;               // Output of ImFont::CalcTextSizeA(), valid when HasSize
+    bool                    HasSize;
+    bool                    HasGlyphs;
+    ImVector<ImGuiTextLayoutGlyph> Glyphs;      // Output of ImFontCalcTextLayout(), valid when HasGlyphs
+
+    ImGuiTextLayout()       { Key = 0; LastFrameUsed = -1; Font = NULL; FontSize = WrapWidth = 0.0f; FontGlyphs = NULL; FontGlyphsGeneration = 0; HasSize = HasGlyphs = false; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Data types support
 //-----------------------------------------------------------------------------
@@ -1075,6 +1147,18 @@ struct IMGUI_API ImGuiGroupData
     bool        BackupHoveredIdIsAlive;
     bool        BackupIsSameLine;
     bool        EmitItem;
+    ImGuiID     ClipGroupID;            // Set by BeginClipGroup()
+};
+
+// Storage data for BeginClipGroup()/EndClipGroup(), persisting across frames
+struct IMGUI_API ImGuiClipGroupData
+{
+    ImGuiID     ID;
+    ImVec2      Size;                   // Size measured by last EndClipGroup(), or -1.0f
+    float       TextBaseOffset;         // Text baseline offset of the group's last line, to align items following a skipped group on the same line
+    ImGuiID     ActiveId;               // Current or previous frame's active item which was submitted within the group. Group is not skipped while this is active.
+
+    ImGuiClipGroupData() { ID = 0; Size = ImVec2(-1.0f, -1.0f); TextBaseOffset = 0.0f; ActiveId = 0; }
 };
 
 // Simple column measurement, currently used for MenuItem() only.. This is very short-sighted/throw-away code and NOT a generic helper.
@@ -1112,9 +1196,13 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiID                 ID;                     // widget id owning the text state
     int                     CurLenW, CurLenA;       // we need to maintain our buffer length in both UTF-8 and wchar format. UTF-8 length is valid even if TextA is not.
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
-    ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
+    ImVector<char>          TextA;                  // UTF8 copy of TextW, used for display and callbacks. updated incrementally by edits once the widget is active. size=capacity.
     ImVector<char>          InitialTextA;           // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
-    bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
+    bool                    TextAIsValid;           // UTF8 buffer is not valid before we make the widget active (until then we pull the data from user argument)
+    int                     TextADirtyOffset;       // offset of first byte of TextA modified since last copy to end-user buffer, INT_MAX if none.
+    int                     TextAPosCacheW, TextAPosCacheA; // last position converted by ConvertPosWToA(), in both formats. Edits are generally near the previous one, so this avoids scanning from start of text.
+    ImVector<int>           LineIndex;              // (multi-line) offset in TextW of the beginning of each line, so we can locate/render visible lines without scanning whole text. built on demand, then updated by edits.
+    bool                    LineIndexValid;
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
     ImStb::STB_TexteditState Stb;                   // state for stb_textedit.h
@@ -1128,8 +1216,10 @@ struct IMGUI_API ImGuiInputTextState
     int                     ReloadSelectionEnd;
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; OnTextReloaded(); CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); LineIndex.clear(); LineIndexValid = false; }
+    void        OnTextReloaded()            { TextADirtyOffset = 0; TextAPosCacheW = TextAPosCacheA = 0; LineIndexValid = false; } // Call after replacing whole contents of TextW/TextA
+    int         ConvertPosWToA(int pos_w);  // Convert a position in TextW to an offset in TextA
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return IMSTB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -1277,6 +1367,30 @@ struct IMGUI_API ImGuiStackSizes
     void CompareWithContextState(ImGuiContext* ctx);
 };
 
+// Uniform grid over hoverable windows, for FindHoveredWindowEx() (see io.ConfigWindowsHoverGrid)
+// Built on the second search since windows last changed, as building costs more than a single linear search.
+// Each cell lists indices into g.Windows[] of windows whose padded OuterRectClipped overlaps the cell, front to back.
+struct ImGuiWindowHoverGrid
+{
+    bool                    Valid;              // Cleared when windows are created/reordered, or appear/move/change hit-test flags in Begin()
+    int                     SearchCount;        // Number of searches since grid was invalidated
+    int                     CellsX, CellsY;
+    ImVec2                  Origin;             // Top-left corner of cell (0,0)
+    ImVec2                  CellInvSize;        // 1.0f / cell size
+    ImVec2                  PaddingRegular;     // Hit-test paddings used to build the grid
+    ImVec2                  PaddingForResize;
+    ImVector<int>           CellOffsets;        // [CellsX * CellsY + 1] Start of each cell in CellWindows[]
+    ImVector<int>           CellWindows;        // Indices into g.Windows[]
+    ImVector<ImRect>        TempRects;          // Padded rectangles of hoverable windows, front to back (during build)
+    ImVector<int>           TempIndices;        // Matching indices into g.Windows[] (during build)
+
+    ImGuiWindowHoverGrid()  { Valid = false; SearchCount = 0; CellsX = CellsY = 0; }
+    void    Invalidate()    { Valid = false; SearchCount = 0; }
+    void    Clear()         { Invalidate(); CellOffsets.clear(); CellWindows.clear(); TempRects.clear(); TempIndices.clear(); }
+    int     GetCellX(float x) const { return (int)ImClamp((x - Origin.x) * CellInvSize.x, 0.0f, (float)(CellsX - 1)); }
+    int     GetCellY(float y) const { return (int)ImClamp((y - Origin.y) * CellInvSize.y, 0.0f, (float)(CellsY - 1)); }
+};
+
 // Data saved for each window pushed into the stack
 struct ImGuiWindowStackData
 {
@@ -1516,10 +1630,13 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    bool                            MeasureHeights;     // Measure displayed items and update ListClipper->ItemsHeights
+    int                             MeasureItemN;       // Item displayed by last step, to measure on next step (or -1)
+    float                           MeasurePosY;        // Cursor position before this item
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureHeights = false; MeasureItemN = -1; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1736,13 +1853,17 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImDrawList*         DrawDataMergedList;     // Output of ImDrawData::MergeDrawLists() when io.ConfigMergeDrawLists is set. Created on demand.
+    int                 DrawDataListCountBeforeMerge; // [Metrics] Number of draw lists in last Render(), before merging
+    int                 DrawDataCmdCountBeforeMerge;  // [Metrics] Number of draw commands (including callbacks) in last Render(), before merging
+    int                 DrawDataCmdCount;       // [Metrics] Number of draw commands (including callbacks) in last Render(), after merging and conversion to 32-bit indices
     ImVec2              WorkOffsetMin;          // Work Area: Offset from Pos to top-left corner of Work Area. Generally (0,0) or (0,+main_menu_bar_height). Work Area is Full Area but without menu-bars/status-bars (so WorkArea always fit inside Pos/Size!)
     ImVec2              WorkOffsetMax;          // Work Area: Offset from Pos+Size to bottom-right corner of Work Area. Generally (0,0) or (0,-status_bar_height).
     ImVec2              BuildWorkOffsetMin;     // Work Area: Offset being built during current frame. Generally >= 0.0f.
     ImVec2              BuildWorkOffsetMax;     // Work Area: Offset being built during current frame. Generally <= 0.0f.
 
-    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; DrawDataMergedList = NULL; DrawDataListCountBeforeMerge = DrawDataCmdCountBeforeMerge = DrawDataCmdCount = 0; }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); if (DrawDataMergedList) IM_DELETE(DrawDataMergedList); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& off_min) const                            { return ImVec2(Pos.x + off_min.x, Pos.y + off_min.y); }
@@ -1849,6 +1970,7 @@ struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
+    int         TotalFrameAllocCount;       // Number of call to MemAllocFrame(). Those are served by g.FrameArena and only reach MemAlloc() when the arena needs a new block.
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
 
@@ -1929,6 +2051,11 @@ struct ImGuiContext
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImVector<ImGuiTextLayout> TextLayoutCache;                  // Cached size and glyphs of recently measured/rendered text (when io.ConfigTextLayoutCache is set)
+    ImGuiStorage            TextLayoutCacheMap;                 // Key -> index into TextLayoutCache. Uses a hash table (thousands of keys, new text adds keys every frame), rebuilt when discarding unused entries.
+    int                     TextLayoutCacheLastIdx;             // Index of last looked up entry, or -1
+    int                     TextLayoutCacheHitCount;            // Stats: total lookups reusing cached size or glyphs
+    int                     TextLayoutCacheMissCount;           // Stats
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1955,6 +2082,7 @@ struct ImGuiContext
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING).
+    ImGuiWindowHoverGrid    WindowsHoverGrid;                   // Spatial index for FindHoveredWindowEx() when many windows are visible (see io.ConfigWindowsHoverGrid)
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -2128,6 +2256,10 @@ struct ImGuiContext
     int                             ClipperTempDataStacked;
     ImVector<ImGuiListClipperData>  ClipperTempData;
 
+    // Clip groups
+    ImPool<ImGuiClipGroupData>      ClipGroups;                 // Persistent clip group data (see BeginClipGroup())
+    int                             ClipGroupsSkipCount;        // Stats: total clip groups skipped
+
     // Tables
     ImGuiTable*                     CurrentTable;
     ImGuiID                         DebugBreakInTable;          // Set to break in BeginTable() call.
@@ -2239,6 +2371,7 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImArenaAllocator        FrameArena;                         // Storage for MemAllocFrame(): transient allocations valid until the next NewFrame()
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2248,6 +2381,10 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
+    float                   RefreshDelay;                       // Smallest delay passed to RequestRefreshEx() during the frame (FLT_MAX if none). Output to io.WantRefresh/io.RefreshTimeout.
+    const char*             RefreshReason;                      // Reason passed along smallest RefreshDelay (for Metrics/Debugger, not cleared when there is no request)
+    int                     RefreshSettleFrames;                // Frames to keep refreshing after inputs, as many widgets react one frame late (e.g. hovered window, popups opening)
+    ImVec2                  RefreshDisplaySizePrev;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
 
@@ -2260,6 +2397,8 @@ struct ImGuiContext
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
         Font = NULL;
         FontSize = FontBaseSize = CurrentDpiScale = 0.0f;
+        TextLayoutCacheHitCount = TextLayoutCacheMissCount = 0;
+        TextLayoutCacheLastIdx = -1;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
         Time = 0.0f;
         FrameCount = 0;
@@ -2374,6 +2513,7 @@ struct ImGuiContext
         memset(DragDropPayloadBufLocal, 0, sizeof(DragDropPayloadBufLocal));
 
         ClipperTempDataStacked = 0;
+        ClipGroupsSkipCount = 0;
 
         CurrentTable = NULL;
         TablesTempDataStacked = 0;
@@ -2447,6 +2587,9 @@ struct ImGuiContext
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        RefreshDelay = FLT_MAX;
+        RefreshReason = NULL;
+        RefreshSettleFrames = 0;
         memset(TempKeychordName, 0, sizeof(TempKeychordName));
     }
 };
@@ -3066,6 +3209,10 @@ namespace ImGui
     IMGUI_API void          UpdateMouseMovingWindowNewFrame();
     IMGUI_API void          UpdateMouseMovingWindowEndFrame();
 
+    // Idling (see io.WantRefresh, io.RefreshTimeout)
+    IMGUI_API void          RequestRefreshEx(float delay, const char* reason);
+    IMGUI_API void          UpdateRefreshEndFrame();
+
     // Generic context hooks
     IMGUI_API ImGuiID       AddContextHook(ImGuiContext* context, const ImGuiContextHook* hook);
     IMGUI_API void          RemoveContextHook(ImGuiContext* context, ImGuiID hook_to_remove);
@@ -3136,6 +3283,7 @@ namespace ImGui
     IMGUI_API bool          IsItemToggledSelection();                                   // Was the last item selection toggled? (after Selectable(), TreeNode() etc. We only returns toggle _event_ in order to handle clipping correctly)
     IMGUI_API ImVec2        GetContentRegionMaxAbs();
     IMGUI_API void          ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_excess);
+    IMGUI_API bool          BeginClipGroupEx(ImGuiID id, const ImVec2& size);
 
     // Parameter stacks (shared)
     IMGUI_API void          PushItemFlag(ImGuiItemFlags option, bool enabled);
@@ -3492,13 +3640,16 @@ namespace ImGui
     IMGUI_API void          ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags flags);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, const ImGuiPlotMinMaxCache* minmax_cache = NULL, int minmax_cache_start = 0);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
     IMGUI_API void          ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out);
 
+    // Memory
+    IMGUI_API void*         MemAllocFrame(size_t size);         // Allocate from g.FrameArena: memory is valid until the next NewFrame() and must NOT be freed. Doesn't reach MemAlloc() in steady state.
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
@@ -3585,6 +3736,14 @@ IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void      ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);     // Rasterize glyphs requested by FindGlyph() during last frame. Called by NewFrame().
+IMGUI_API bool      ImFontAtlasHasDynamicGlyphRequests(ImFontAtlas* atlas); // Return true if FindGlyph() queued glyphs since last ImFontAtlasUpdateDynamicGlyphs().
+IMGUI_API void      ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas);
+IMGUI_API int       ImFontGetGlyphsGeneration(const ImFont* font);          // Incremented when glyphs of a font using ImFontAtlasFlags_DynamicGlyphs are loaded or evicted, 0 for other fonts.
+
+// Helpers for text layout cache (see io.ConfigTextLayoutCache)
+IMGUI_API void      ImFontCalcTextLayout(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<ImGuiTextLayoutGlyph>* out_glyphs);
+IMGUI_API void      ImFontRenderTextLayout(const ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImGuiTextLayout* layout);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Sorter, Virtualizer
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -1152,6 +1153,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0)
+                RequestRefreshEx(0.0f, "Table auto-fit");
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -2961,6 +2964,418 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Sorter, Virtualizer
+//-------------------------------------------------------------------------
+// - ImGuiTableSorter::Sort()
+// - TableVirtualizerSortItems() [Internal]
+// - TableVirtualizerGetRowHeight() [Internal]
+// - ImGuiTableVirtualizer::Begin()
+// - ImGuiTableVirtualizer::Step()
+// - ImGuiTableVirtualizer::NextRow()
+//-------------------------------------------------------------------------
+
+// Shared by sorting jobs. Keys[n] is the sort key of item Indices[n].
+struct ImGuiTableSorterContext
+{
+    ImGuiTableSorter*           Sorter;
+    const ImGuiTableSortSpecs*  SortSpecs;
+    ImGuiTableSortKeyFunc       KeyFunc;
+    void*                       UserData;
+    ImVector<int>*              Indices;
+    int                         ItemsCount;
+    int                         ChunkSize;          // Items per job
+    int                         ChunksCount;
+    int                         SpecN;              // Sort spec of keys being extracted
+    int                         Pass;               // Current radix sort pass, sorting on 8-bit digit at (Pass * 8)
+    ImVector<int>               Histograms;         // 8 passes * 256 counters per chunk, converted to output offsets (full sort only)
+    ImVector<int>               Groups;             // Pairs of [begin, end) ranges of items with equal primary keys
+    ImVector<int>               GroupsJobs;         // First group of each job, then groups count
+};
+
+// Make IEEE 754 doubles comparable as unsigned integers, flipped for descending order
+static inline ImU64 TableSorterMakeKey(double v, ImGuiSortDirection sort_direction)
+{
+    if (v == 0.0)
+        v = 0.0; // Merge -0.0 and +0.0
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    bits = (bits & ((ImU64)1 << 63)) ? ~bits : (bits | ((ImU64)1 << 63));
+    return (sort_direction == ImGuiSortDirection_Descending) ? ~bits : bits;
+}
+
+// Use spec_n == -1 to use item index as key
+static void TableSorterExtractKeys(ImGuiTableSorterContext* ctx, int spec_n, int begin, int end)
+{
+    ImU64* keys = ctx->Sorter->Keys.Data;
+    const int* indices = ctx->Indices->Data;
+    if (spec_n < 0)
+    {
+        for (int n = begin; n < end; n++)
+            keys[n] = (ImU64)indices[n];
+        return;
+    }
+    const ImGuiTableColumnSortSpecs* sort_spec = &ctx->SortSpecs->Specs[spec_n];
+    for (int n = begin; n < end; n++)
+        keys[n] = TableSorterMakeKey(ctx->KeyFunc(ctx->UserData, sort_spec, indices[n]), sort_spec->SortDirection);
+}
+
+// Stable sort of a small range of keys/indices, serially (used when sorting groups of equal primary keys)
+static void TableSorterSortRange(ImU64* keys, int* indices, ImU64* temp_keys, int* temp_indices, int count)
+{
+    if (count <= 32)
+    {
+        // Insertion sort
+        for (int i = 1; i < count; i++)
+        {
+            const ImU64 key = keys[i];
+            const int index = indices[i];
+            int j = i;
+            for (; j > 0 && keys[j - 1] > key; j--)
+            {
+                keys[j] = keys[j - 1];
+                indices[j] = indices[j - 1];
+            }
+            keys[j] = key;
+            indices[j] = index;
+        }
+        return;
+    }
+
+    // LSD radix sort, skipping passes where all items have the same digit. Histograms of all passes are built at once.
+    int offsets[8][256] = {};
+    for (int n = 0; n < count; n++)
+    {
+        const ImU64 key = keys[n];
+        for (int pass = 0; pass < 8; pass++)
+            offsets[pass][(key >> (pass * 8)) & 0xFF]++;
+    }
+    for (int pass = 0; pass < 8; pass++)
+    {
+        const int shift = pass * 8;
+        int* pass_offsets = offsets[pass];
+        if (pass_offsets[(keys[0] >> shift) & 0xFF] == count)
+            continue;
+        for (int digit = 0, offset = 0; digit < 256; digit++)
+        {
+            const int digit_count = pass_offsets[digit];
+            pass_offsets[digit] = offset;
+            offset += digit_count;
+        }
+        for (int n = 0; n < count; n++)
+        {
+            const int dst = pass_offsets[(keys[n] >> shift) & 0xFF]++;
+            temp_keys[dst] = keys[n];
+            temp_indices[dst] = indices[n];
+        }
+        memcpy(keys, temp_keys, (size_t)count * sizeof(ImU64));
+        memcpy(indices, temp_indices, (size_t)count * sizeof(int));
+    }
+}
+
+// Extract keys of a chunk. For a full sort, also build the histograms of all passes for this chunk.
+static void TableSorterExtractKeysJob(void* job_data, int job_n)
+{
+    ImGuiTableSorterContext* ctx = (ImGuiTableSorterContext*)job_data;
+    const int n_begin = job_n * ctx->ChunkSize;
+    const int n_end = ImMin((job_n + 1) * ctx->ChunkSize, ctx->ItemsCount);
+    TableSorterExtractKeys(ctx, ctx->SpecN, n_begin, n_end);
+    if (ctx->Histograms.Size == 0)
+        return;
+    const ImU64* keys = ctx->Sorter->Keys.Data;
+    int* counts = &ctx->Histograms.Data[job_n * 8 * 256];
+    memset(counts, 0, 8 * 256 * sizeof(int));
+    for (int n = n_begin; n < n_end; n++)
+    {
+        const ImU64 key = keys[n];
+        for (int pass = 0; pass < 8; pass++)
+            counts[pass * 256 + ((key >> (pass * 8)) & 0xFF)]++;
+    }
+}
+
+// Rebuild histogram of current pass for a chunk (needed when items were moved across chunks by a previous pass)
+static void TableSorterHistogramJob(void* job_data, int job_n)
+{
+    ImGuiTableSorterContext* ctx = (ImGuiTableSorterContext*)job_data;
+    const ImU64* keys = ctx->Sorter->Keys.Data;
+    const int shift = ctx->Pass * 8;
+    int* counts = &ctx->Histograms.Data[(job_n * 8 + ctx->Pass) * 256];
+    memset(counts, 0, 256 * sizeof(int));
+    for (int n = job_n * ctx->ChunkSize, n_end = ImMin((job_n + 1) * ctx->ChunkSize, ctx->ItemsCount); n < n_end; n++)
+        counts[(keys[n] >> shift) & 0xFF]++;
+}
+
+static void TableSorterScatterJob(void* job_data, int job_n)
+{
+    ImGuiTableSorterContext* ctx = (ImGuiTableSorterContext*)job_data;
+    ImGuiTableSorter* sorter = ctx->Sorter;
+    const ImU64* keys = sorter->Keys.Data;
+    const int* indices = ctx->Indices->Data;
+    ImU64* out_keys = sorter->TempKeys.Data;
+    int* out_indices = sorter->TempIndices.Data;
+    const int shift = ctx->Pass * 8;
+    int* offsets = &ctx->Histograms.Data[(job_n * 8 + ctx->Pass) * 256];
+    for (int n = job_n * ctx->ChunkSize, n_end = ImMin((job_n + 1) * ctx->ChunkSize, ctx->ItemsCount); n < n_end; n++)
+    {
+        const int dst = offsets[(keys[n] >> shift) & 0xFF]++;
+        out_keys[dst] = keys[n];
+        out_indices[dst] = indices[n];
+    }
+}
+
+static void TableSorterSortGroupsJob(void* job_data, int job_n)
+{
+    ImGuiTableSorterContext* ctx = (ImGuiTableSorterContext*)job_data;
+    ImGuiTableSorter* sorter = ctx->Sorter;
+    for (int group_n = ctx->GroupsJobs[job_n]; group_n < ctx->GroupsJobs[job_n + 1]; group_n++)
+    {
+        // Same as a full sort, within a group: start from item index order, then sort by each secondary spec from last to first.
+        const int begin = ctx->Groups[group_n * 2 + 0];
+        const int end = ctx->Groups[group_n * 2 + 1];
+        for (int spec_n = -1; spec_n == -1 || spec_n >= 1; spec_n = (spec_n == -1) ? ctx->SortSpecs->SpecsCount - 1 : spec_n - 1)
+        {
+            TableSorterExtractKeys(ctx, spec_n, begin, end);
+            TableSorterSortRange(sorter->Keys.Data + begin, ctx->Indices->Data + begin, sorter->TempKeys.Data + begin, sorter->TempIndices.Data + begin, end - begin);
+        }
+    }
+}
+
+static void TableSorterRunJobs(ImGuiTableSorterContext* ctx, ImGuiJobFunc job_func, int jobs_count)
+{
+    ImGuiTableSorter* sorter = ctx->Sorter;
+    if (sorter->ParallelForFunc != NULL && jobs_count > 1)
+        sorter->ParallelForFunc(job_func, ctx, jobs_count, sorter->ParallelForUserData);
+    else
+        for (int job_n = 0; job_n < jobs_count; job_n++)
+            job_func(ctx, job_n);
+}
+
+static bool TableSorterIsSameSortSpec(const ImGuiTableColumnSortSpecs* a, const ImGuiTableColumnSortSpecs* b)
+{
+    return a->ColumnUserID == b->ColumnUserID && a->ColumnIndex == b->ColumnIndex && a->SortDirection == b->SortDirection;
+}
+
+// Sort 'indices', which contains the output of the previous call (or anything when items changed, after calling Invalidate()).
+void ImGuiTableSorter::Sort(const ImGuiTableSortSpecs* sort_specs, ImVector<int>* indices, int items_count, ImGuiTableSortKeyFunc key_func, void* user_data)
+{
+    IM_ASSERT(sort_specs != NULL && indices != NULL && key_func != NULL && items_count >= 0);
+    const int specs_count = sort_specs->SpecsCount;
+
+    // Reuse previous permutation when primary sort spec didn't change
+    const bool can_reuse = !NeedFullSort && PrevItemsCount == items_count && indices->Size == items_count && specs_count > 0 && PrevSpecs.Size > 0 && TableSorterIsSameSortSpec(&PrevSpecs[0], &sort_specs->Specs[0]);
+    if (can_reuse && PrevSpecs.Size == specs_count)
+    {
+        bool same_specs = true;
+        for (int spec_n = 1; spec_n < specs_count && same_specs; spec_n++)
+            same_specs = TableSorterIsSameSortSpec(&PrevSpecs[spec_n], &sort_specs->Specs[spec_n]);
+        if (same_specs)
+            return;
+    }
+    PrevSpecs.resize(specs_count);
+    if (specs_count > 0)
+        memcpy(PrevSpecs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+    PrevItemsCount = items_count;
+    NeedFullSort = false;
+
+    ImGuiTableSorterContext ctx;
+    ctx.Sorter = this;
+    ctx.SortSpecs = sort_specs;
+    ctx.KeyFunc = key_func;
+    ctx.UserData = user_data;
+    ctx.Indices = indices;
+    ctx.ItemsCount = items_count;
+    ctx.ChunkSize = (ParallelForFunc != NULL) ? ImMax(16384, (items_count + 63) / 64) : ImMax(items_count, 1);
+    ctx.ChunksCount = (items_count + ctx.ChunkSize - 1) / ctx.ChunkSize;
+    ctx.SpecN = 0;
+    ctx.Pass = 0;
+    Keys.resize(items_count);
+    TempKeys.resize(items_count);
+    TempIndices.resize(items_count);
+
+    if (!can_reuse)
+    {
+        // Full sort: LSD radix sort on each sort spec, from last to first
+        indices->resize(items_count);
+        for (int n = 0; n < items_count; n++)
+            indices->Data[n] = n;
+        ctx.Histograms.resize(ctx.ChunksCount * 8 * 256);
+        for (int spec_n = specs_count - 1; spec_n >= 0 && items_count > 0; spec_n--)
+        {
+            ctx.SpecN = spec_n;
+            TableSorterRunJobs(&ctx, TableSorterExtractKeysJob, ctx.ChunksCount);
+            bool items_moved = false;
+            for (ctx.Pass = 0; ctx.Pass < 8; ctx.Pass++)
+            {
+                // Skip pass if all items have the same digit (counting all chunks). Histograms built with keys are still valid for this pass.
+                const int digit0 = (int)((Keys.Data[0] >> (ctx.Pass * 8)) & 0xFF);
+                int digit0_count = 0;
+                for (int chunk_n = 0; chunk_n < ctx.ChunksCount; chunk_n++)
+                    digit0_count += ctx.Histograms.Data[(chunk_n * 8 + ctx.Pass) * 256 + digit0];
+                if (digit0_count == items_count)
+                    continue;
+                if (items_moved && ctx.ChunksCount > 1)
+                    TableSorterRunJobs(&ctx, TableSorterHistogramJob, ctx.ChunksCount);
+
+                // Convert counts to output offsets: items are ordered by digit, then by chunk (which keeps the sort stable)
+                int offset = 0;
+                for (int digit = 0; digit < 256; digit++)
+                    for (int chunk_n = 0; chunk_n < ctx.ChunksCount; chunk_n++)
+                    {
+                        int* p = &ctx.Histograms.Data[(chunk_n * 8 + ctx.Pass) * 256 + digit];
+                        const int digit_count = *p;
+                        *p = offset;
+                        offset += digit_count;
+                    }
+                TableSorterRunJobs(&ctx, TableSorterScatterJob, ctx.ChunksCount);
+                items_moved = true;
+                Keys.swap(TempKeys);
+                indices->swap(TempIndices);
+            }
+        }
+    }
+    else
+    {
+        // Partial sort: find groups of items with equal primary keys, and sort each group by secondary sort specs.
+        TableSorterRunJobs(&ctx, TableSorterExtractKeysJob, ctx.ChunksCount);
+        for (int begin = 0, end = 1; begin < items_count; begin = end, end = begin + 1)
+        {
+            while (end < items_count && Keys.Data[end] == Keys.Data[begin])
+                end++;
+            if (end - begin > 1)
+            {
+                ctx.Groups.push_back(begin);
+                ctx.Groups.push_back(end);
+            }
+        }
+
+        // Split groups into jobs of about ChunkSize items
+        const int groups_count = ctx.Groups.Size / 2;
+        for (int group_n = 0, job_items = ctx.ChunkSize; group_n < groups_count; group_n++)
+        {
+            if (job_items >= ctx.ChunkSize)
+            {
+                ctx.GroupsJobs.push_back(group_n);
+                job_items = 0;
+            }
+            job_items += ctx.Groups[group_n * 2 + 1] - ctx.Groups[group_n * 2 + 0];
+        }
+        const int jobs_count = ctx.GroupsJobs.Size;
+        ctx.GroupsJobs.push_back(groups_count);
+        TableSorterRunJobs(&ctx, TableSorterSortGroupsJob, jobs_count);
+    }
+
+    // Free temporary buffers
+    Keys.clear();
+    TempKeys.clear();
+    TempIndices.clear();
+}
+
+// Stable sort of item indices: bottom-up merge sort, ties are ordered by item index.
+static void TableVirtualizerSortItems(ImGuiTableVirtualizer* virt, const ImGuiTableSortSpecs* sort_specs)
+{
+    const int items_count = virt->ItemsCount;
+    virt->ItemIndices.resize(items_count);
+    virt->SortTempBuffer.resize(items_count);
+    for (int item_n = 0; item_n < items_count; item_n++)
+        virt->ItemIndices.Data[item_n] = item_n;
+
+    int* src = virt->ItemIndices.Data;
+    int* dst = virt->SortTempBuffer.Data;
+    for (int width = 1; width < items_count; width *= 2)
+    {
+        for (int lo = 0; lo < items_count; lo += width * 2)
+        {
+            const int mid = ImMin(lo + width, items_count);
+            const int hi = ImMin(lo + width * 2, items_count);
+            int i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+                dst[k++] = (virt->CompareFunc(virt->UserData, sort_specs, src[j], src[i]) < 0) ? src[j++] : src[i++];
+            while (i < mid)
+                dst[k++] = src[i++];
+            while (j < hi)
+                dst[k++] = src[j++];
+        }
+        ImSwap(src, dst);
+    }
+    if (src != virt->ItemIndices.Data)
+        memcpy(virt->ItemIndices.Data, src, (size_t)items_count * sizeof(int));
+    virt->SortTempBuffer.clear();
+}
+
+static float TableVirtualizerGetRowHeight(void* user_data, int row_n)
+{
+    ImGuiTableVirtualizer* virt = (ImGuiTableVirtualizer*)user_data;
+    return virt->RowHeightFunc(virt->UserData, virt->GetItemIndex(row_n));
+}
+
+// Sort items and rebuild row heights if needed, then begin clipping.
+// This is O(items_count) when items or sort specs changed, O(log items_count) otherwise.
+void ImGuiTableVirtualizer::Begin(int items_count)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentTable != NULL && "Need to call ImGuiTableVirtualizer::Begin() inside a BeginTable()/EndTable() block!");
+    IM_ASSERT(items_count >= 0);
+
+    const bool items_changed = (ItemsCount != items_count) || NeedRebuild;
+    ItemsCount = items_count;
+    NeedRebuild = false;
+    DisplayStart = DisplayEnd = 0;
+
+    // Sort
+    bool order_changed = false;
+    if (items_changed)
+        Sorter.Invalidate();
+    ImGuiTableSortSpecs* sort_specs = (SortKeyFunc != NULL || CompareFunc != NULL) ? ImGui::TableGetSortSpecs() : NULL;
+    if (sort_specs != NULL && sort_specs->SpecsCount > 0)
+    {
+        if (sort_specs->SpecsDirty || items_changed || ItemIndices.Size != items_count)
+        {
+            if (SortKeyFunc != NULL)
+                Sorter.Sort(sort_specs, &ItemIndices, items_count, SortKeyFunc, UserData);
+            else
+                TableVirtualizerSortItems(this, sort_specs);
+            order_changed = true;
+        }
+        sort_specs->SpecsDirty = false;
+    }
+    else
+    {
+        if (sort_specs != NULL)
+            sort_specs->SpecsDirty = false;
+        if (ItemIndices.Size > 0)
+            order_changed = true;
+        ItemIndices.clear();
+        Sorter.Invalidate();
+    }
+
+    // Row heights
+    if (RowHeightFunc != NULL)
+    {
+        if (items_changed || order_changed || RowHeights.GetItemsCount() != items_count)
+            RowHeights.Build(items_count, TableVirtualizerGetRowHeight, this);
+        Clipper.BeginWithHeights(&RowHeights);
+    }
+    else
+    {
+        RowHeights.Clear();
+        Clipper.Begin(items_count, (RowHeight > 0.0f) ? RowHeight : -1.0f);
+    }
+}
+
+bool ImGuiTableVirtualizer::Step()
+{
+    const bool ret = Clipper.Step();
+    DisplayStart = Clipper.DisplayStart;
+    DisplayEnd = Clipper.DisplayEnd;
+    return ret;
+}
+
+void ImGuiTableVirtualizer::NextRow(int row_n, ImGuiTableRowFlags row_flags)
+{
+    const float row_height = (RowHeightFunc != NULL) ? RowHeights.GetItemHeight(row_n) : RowHeight;
+    ImGui::TableNextRow(row_flags, row_height);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3756,6 +3756,69 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     return text_size;
 }
 
+// (multi-line) Line index: offset of the beginning of each line in TextW.
+// Built on first use, then updated by STB_TEXTEDIT_INSERTCHARS()/STB_TEXTEDIT_DELETECHARS(), so finding the line of a given
+// position is a binary search and we can render visible lines only. Updating is O(lines after edit) but doesn't need to read text.
+static void InputTextLineIndexBuild(ImGuiInputTextState* state)
+{
+    ImVector<int>& line_index = state->LineIndex;
+    line_index.resize(0);
+    line_index.push_back(0);
+    const ImWchar* text = state->TextW.Data;
+    for (int n = 0; n < state->CurLenW; n++)
+        if (text[n] == '\n')
+            line_index.push_back(n + 1);
+    state->LineIndexValid = true;
+}
+
+// Return index of first line starting after 'pos'
+static int InputTextLineIndexUpperBound(const ImVector<int>& line_index, int pos)
+{
+    int lo = 0, hi = line_index.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (line_index.Data[mid] <= pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void InputTextLineIndexOnDeleteChars(ImGuiInputTextState* state, int pos, int n)
+{
+    ImVector<int>& line_index = state->LineIndex;
+    const int idx_begin = InputTextLineIndexUpperBound(line_index, pos);
+    const int idx_end = InputTextLineIndexUpperBound(line_index, pos + n); // Lines starting within deleted range are removed
+    if (idx_begin != idx_end)
+        line_index.erase(line_index.Data + idx_begin, line_index.Data + idx_end);
+    for (int idx = idx_begin; idx < line_index.Size; idx++)
+        line_index.Data[idx] -= n;
+}
+
+static void InputTextLineIndexOnInsertChars(ImGuiInputTextState* state, int pos, const ImWchar* new_text, int new_text_len)
+{
+    ImVector<int>& line_index = state->LineIndex;
+    int new_lines = 0;
+    for (int n = 0; n < new_text_len; n++)
+        if (new_text[n] == '\n')
+            new_lines++;
+    const int idx_begin = InputTextLineIndexUpperBound(line_index, pos);
+    const int old_size = line_index.Size;
+    if (new_lines > 0)
+    {
+        line_index.resize(old_size + new_lines);
+        memmove(line_index.Data + idx_begin + new_lines, line_index.Data + idx_begin, (size_t)(old_size - idx_begin) * sizeof(int));
+        int* p_out = line_index.Data + idx_begin;
+        for (int n = 0; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+                *p_out++ = pos + n + 1;
+    }
+    for (int idx = idx_begin + new_lines; idx < line_index.Size; idx++)
+        line_index.Data[idx] += new_text_len;
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
@@ -3817,16 +3880,23 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
     ImWchar* dst = obj->TextW.Data + pos;
 
-    // We maintain our buffer length in both UTF-8 and wchar formats
+    // We maintain our buffer in both UTF-8 and wchar formats.
+    // Only the bytes following the edit are moved, so we don't need to convert the whole text back to UTF-8.
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
+    const int pos_a = obj->TextAIsValid ? obj->ConvertPosWToA(pos) : 0;
+    const int n_a = ImTextCountUtf8BytesFromStr(dst, dst + n);
+    if (obj->TextAIsValid)
+    {
+        memmove(obj->TextA.Data + pos_a, obj->TextA.Data + pos_a + n_a, (size_t)(obj->CurLenA - pos_a - n_a + 1));
+        obj->TextADirtyOffset = ImMin(obj->TextADirtyOffset, pos_a);
+    }
+    if (obj->LineIndexValid)
+        InputTextLineIndexOnDeleteChars(obj, pos, n);
+    obj->CurLenA -= n_a;
     obj->CurLenW -= n;
 
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    // Offset remaining text, including zero-terminator
+    memmove(dst, dst + n, (size_t)(obj->CurLenW - pos + 1) * sizeof(ImWchar));
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
@@ -3848,6 +3918,23 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
         obj->TextW.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
     }
 
+    // Update UTF-8 buffer in place (before TextW is modified, as we need it to locate the insertion point)
+    if (obj->TextAIsValid)
+    {
+        if (obj->CurLenA + new_text_len_utf8 + 1 > obj->TextA.Size)
+            obj->TextA.resize(obj->CurLenA + new_text_len_utf8 + 1);
+        const int pos_a = obj->ConvertPosWToA(pos);
+        char* text_a = obj->TextA.Data;
+        memmove(text_a + pos_a + new_text_len_utf8, text_a + pos_a, (size_t)(obj->CurLenA - pos_a + 1));
+        const char backup_c = text_a[pos_a + new_text_len_utf8];    // ImTextStrToUtf8() writes a zero-terminator
+        ImTextStrToUtf8(text_a + pos_a, new_text_len_utf8 + 1, new_text, new_text + new_text_len);
+        text_a[pos_a + new_text_len_utf8] = backup_c;
+        obj->TextADirtyOffset = ImMin(obj->TextADirtyOffset, pos_a);
+    }
+
+    if (obj->LineIndexValid)
+        InputTextLineIndexOnInsertChars(obj, pos, new_text, new_text_len);
+
     ImWchar* text = obj->TextW.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos) * sizeof(ImWchar));
@@ -3911,6 +3998,29 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+// Scan from the closest of: start of text, end of text, last converted position.
+// With only 1-byte characters the conversion is direct.
+int ImGuiInputTextState::ConvertPosWToA(int pos_w)
+{
+    IM_ASSERT(pos_w >= 0);
+    pos_w = ImMin(pos_w, CurLenW); // Selection may not be clamped yet
+    if (CurLenA == CurLenW)
+        return pos_w;
+    int from_w = 0, from_a = 0;
+    if (TextAPosCacheW <= CurLenW && ImAbs(pos_w - TextAPosCacheW) < pos_w)
+        from_w = TextAPosCacheW, from_a = TextAPosCacheA;
+    if (CurLenW - pos_w < ImAbs(pos_w - from_w))
+        from_w = CurLenW, from_a = CurLenA;
+    const ImWchar* text = TextW.Data;
+    if (pos_w >= from_w)
+        from_a += ImTextCountUtf8BytesFromStr(text + from_w, text + pos_w);
+    else
+        from_a -= ImTextCountUtf8BytesFromStr(text + pos_w, text + from_w);
+    TextAPosCacheW = pos_w;
+    TextAPosCacheA = from_a;
+    return from_a;
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
@@ -3956,7 +4066,7 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
         IM_ASSERT(edit_state->ID != 0 && g.ActiveId == edit_state->ID);
         IM_ASSERT(Buf == edit_state->TextA.Data);
         int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
-        edit_state->TextA.reserve(new_buf_size + 1);
+        edit_state->TextA.resize(new_buf_size + 1);
         Buf = edit_state->TextA.Data;
         BufSize = edit_state->BufCapacityA = new_buf_size;
     }
@@ -4278,11 +4388,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const char* buf_end = NULL;
         state->ID = id;
         state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
+        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, buf + buf_len, &buf_end);
         state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
 
+        // Take a copy of the UTF-8 text. From now on it is kept in sync by edits, and copied back to 'buf' only from the first modified byte.
+        state->TextA.resize(ImMax(buf_size, state->CurLenA) + 1);
+        memcpy(state->TextA.Data, buf, state->CurLenA);
+        state->TextA[state->CurLenA] = 0;
+        state->TextAIsValid = true;
+        state->OnTextReloaded();
+        state->TextADirtyOffset = (buf_len != state->CurLenA) ? state->CurLenA : INT_MAX; // Write back if we cut off malformed UTF-8
+
         if (recycle_state)
         {
             // Recycle existing cursor/selection/undo stack but clamp position
@@ -4361,12 +4477,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
     // When read-only we always use the live data passed to the function
     // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
+    // We keep a copy in TextA so we only convert when the data changed, which is much cheaper to detect and preserves our line index.
     if (is_readonly && state != NULL && (render_cursor || render_selection))
     {
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);
+        if (state->CurLenA >= buf_size || state->TextA.Size < state->CurLenA + 1 || memcmp(state->TextA.Data, buf, (size_t)state->CurLenA + 1) != 0)
+        {
+            const char* buf_end = NULL;
+            state->TextW.resize(buf_size + 1);
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
+            state->CurLenA = (int)(buf_end - buf);
+            state->TextA.resize(ImMax(state->TextA.Size, state->CurLenA + 1));
+            memcpy(state->TextA.Data, buf, (size_t)state->CurLenA);
+            state->TextA[state->CurLenA] = 0;
+            state->OnTextReloaded();
+        }
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
@@ -4400,6 +4524,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->Edited = false;
         state->BufCapacityA = buf_size;
         state->Flags = flags;
+        if (!is_readonly && state->TextA.Size < buf_size + 1)
+            state->TextA.resize(buf_size + 1); // Callbacks may write up to BufCapacityA bytes
 
         // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
         // Down the line we should have a cleaner library-wide concept of Selected vs Active.
@@ -4625,10 +4751,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
+                char* clipboard_data = (char*)MemAllocFrame(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4644,7 +4769,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
@@ -4660,7 +4785,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4671,6 +4795,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Process callbacks and apply result back to user's buffer.
     const char* apply_new_text = NULL;
     int apply_new_text_length = 0;
+    int apply_new_text_offset = 0;
     if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
@@ -4693,24 +4818,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
                 value_changed = true;
-                ImVector<ImWchar> w_text;
+                ImWchar* w_text = NULL;
+                int w_text_len = 0;
                 if (apply_new_text_length > 0)
                 {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text_len = ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text = (ImWchar*)MemAllocFrame((w_text_len + 1) * sizeof(ImWchar));
+                    ImTextStrFromUtf8(w_text, w_text_len + 1, apply_new_text, apply_new_text + apply_new_text_length);
                 }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, w_text, w_text_len);
             }
         }
 
-        // Apply ASCII value
-        if (!is_readonly)
-        {
-            state->TextAIsValid = true;
-            state->TextA.resize(state->TextW.Size * 4 + 1);
-            ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
-        }
-
         // When using 'ImGuiInputTextFlags_EnterReturnsTrue' as a special case we reapply the live buffer back to the input buffer
         // before clearing ActiveId, even though strictly speaking it wasn't modified on this frame.
         // If we didn't do that, code like InputInt() with ImGuiInputTextFlags_EnterReturnsTrue would fail.
@@ -4723,7 +4842,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4773,10 +4891,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.BufDirty = false;
 
                     // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
-                    ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    const int utf8_cursor_pos = callback_data.CursorPos = state->ConvertPosWToA(state->Stb.cursor);
+                    const int utf8_selection_start = callback_data.SelectionStart = state->ConvertPosWToA(state->Stb.select_start);
+                    const int utf8_selection_end = callback_data.SelectionEnd = state->ConvertPosWToA(state->Stb.select_end);
 
                     // Call user code
                     callback(&callback_data);
@@ -4797,19 +4914,31 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         InputTextReconcileUndoStateAfterUserCallback(state, callback_data.Buf, callback_data.BufTextLen); // FIXME: Move the rest of this block inside function and rename to InputTextReconcileStateAfterUserCallback() ?
                         if (callback_data.BufTextLen > backup_current_text_length && is_resizable)
                             state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length)); // Worse case scenario resize
-                        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
+                        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, callback_data.Buf + callback_data.BufTextLen);
                         state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->OnTextReloaded();
                         state->CursorAnimReset();
                     }
                 }
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            // Only copy from the first byte modified since last copy, but verify that the bytes before it still match 'buf' in case
+            // user code modified it or doesn't retain its contents across frames. A mismatch anywhere triggers a full copy.
+            if (!is_readonly)
             {
-                apply_new_text = state->TextA.Data;
-                apply_new_text_length = state->CurLenA;
-                value_changed = true;
+                int apply_offset = state->TextADirtyOffset;
+                const int unchanged_len = ImMin(apply_offset, state->CurLenA + 1); // Includes zero terminator when nothing was modified
+                if (unchanged_len > buf_size || apply_offset == buf_size || memcmp(buf, state->TextA.Data, (size_t)unchanged_len) != 0)
+                    apply_offset = 0;
+                if (apply_offset <= state->CurLenA && strcmp(state->TextA.Data + apply_offset, buf + apply_offset) != 0)
+                {
+                    apply_new_text = state->TextA.Data;
+                    apply_new_text_length = state->CurLenA;
+                    apply_new_text_offset = apply_offset;
+                    value_changed = true;
+                }
+                state->TextADirtyOffset = INT_MAX;
             }
         }
     }
@@ -4845,6 +4974,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             callback_data.BufSize = ImMax(buf_size, apply_new_text_length + 1);
             callback_data.UserData = callback_user_data;
             callback(&callback_data);
+            if (buf != callback_data.Buf)
+                apply_new_text_offset = 0;
             buf = callback_data.Buf;
             buf_size = callback_data.BufSize;
             apply_new_text_length = ImMin(callback_data.BufTextLen, buf_size - 1);
@@ -4853,7 +4984,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         //IMGUI_DEBUG_PRINT("InputText(\"%s\"): apply_new_text length %d\n", label, apply_new_text_length);
 
         // If the underlying buffer resize was denied or not carried to the next frame, apply_new_text_length+1 may be >= buf_size.
-        ImStrncpy(buf, apply_new_text, ImMin(apply_new_text_length + 1, buf_size));
+        // Bytes before 'apply_new_text_offset' are known to be already present in 'buf'.
+        const int apply_new_text_size = ImMin(apply_new_text_length + 1, buf_size);
+        if (apply_new_text_offset >= apply_new_text_size)
+            apply_new_text_offset = 0;
+        ImStrncpy(buf + apply_new_text_offset, apply_new_text + apply_new_text_offset, apply_new_text_size - apply_new_text_offset);
     }
 
     // Release active ID at the end of the function (so e.g. pressing Return still does a final application of the value)
@@ -4903,6 +5038,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
+        if (is_multiline && !state->LineIndexValid)
+            InputTextLineIndexBuild(state);
+        const ImVector<int>& line_index = state->LineIndex;
+        int select_start_line_no = -1;
 
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
@@ -4922,23 +5061,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 searches_remaining++;
             }
 
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
             int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_no[0] == -1)
-                searches_result_line_no[0] = line_count;
-            if (searches_result_line_no[1] == -1)
-                searches_result_line_no[1] = line_count;
+            if (is_multiline)
+            {
+                // Find our line numbers from the line index
+                line_count = line_index.Size;
+                for (int n = 0; n < 2; n++)
+                    if (searches_result_line_no[n] == -1)
+                        searches_result_line_no[n] = InputTextLineIndexUpperBound(line_index, (int)(searches_input_ptr[n] - text_begin));
+            }
+            else
+            {
+                // Iterate all lines to find our line numbers
+                //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
+                for (const ImWchar* s = text_begin; *s != 0; s++)
+                    if (*s == '\n')
+                    {
+                        line_count++;
+                        if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
+                        if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
+                    }
+                line_count++;
+                if (searches_result_line_no[0] == -1)
+                    searches_result_line_no[0] = line_count;
+                if (searches_result_line_no[1] == -1)
+                    searches_result_line_no[1] = line_count;
+            }
+            select_start_line_no = searches_result_line_no[1];
 
             // Calculate 2d position by finding the beginning of the line and measuring distance
             cursor_offset.x = InputTextCalcTextSizeW(&g, ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
@@ -5000,7 +5149,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImWchar* p = text_selected_begin;
+            if (is_multiline && rect_pos.y < clip_rect.y)
+            {
+                // Skip to the line above clipping rectangle using line index (remaining lines are skipped below)
+                const int line_no = ImMin((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, line_index.Size);
+                if (line_no > select_start_line_no)
+                {
+                    p = ImMin(text_begin + line_index[line_no - 1], text_selected_end);
+                    rect_pos = ImVec2(draw_pos.x - draw_scroll.x, draw_pos.y + line_no * g.FontSize);
+                }
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -5027,7 +5187,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (is_multiline && !is_displaying_hint)
+        {
+            // Only submit visible lines
+            const int line_min = ImMax((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0);
+            const int line_max = ImMin((int)((clip_rect.w - draw_pos.y) / g.FontSize) + 1, line_index.Size - 1);
+            if (line_min <= line_max)
+            {
+                const char* text_visible_begin = buf_display + state->ConvertPosWToA(line_index[line_min]);
+                const char* text_visible_end = (line_max + 1 < line_index.Size) ? buf_display + state->ConvertPosWToA(line_index[line_max + 1]) : buf_display_end;
+                ImU32 col = GetColorU32(ImGuiCol_Text);
+                draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll + ImVec2(0.0f, line_min * g.FontSize), col, text_visible_begin, text_visible_end, 0.0f, NULL);
+            }
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -5038,6 +5211,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+            {
+                const float cursor_anim_mod = (state->CursorAnim <= 0.0f) ? state->CursorAnim : ImFmod(state->CursorAnim, 1.20f);
+                RequestRefreshEx((cursor_anim_mod <= 0.80f ? 0.80f : 1.20f) - cursor_anim_mod, "Text cursor blink");
+            }
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -7062,6 +7240,7 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
+// - ImGuiPlotMinMaxCache [Helper]
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
@@ -7072,7 +7251,97 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+void ImGuiPlotMinMaxCache::Clear()
+{
+    Values = NULL;
+    ValuesCount = 0;
+    for (ImVector<ImVec2>& level : Levels)
+        level.clear();
+}
+
+// Only new blocks and the last (possibly partial) block of each level are computed.
+void ImGuiPlotMinMaxCache::Update(const float* values, int values_count, int stride)
+{
+    IM_ASSERT(values_count >= 0);
+    if (values_count < ValuesCount || stride != Stride)
+        Clear();
+    int dirty_begin = ValuesCount / 4;
+    Values = values;
+    ValuesCount = values_count;
+    Stride = stride;
+
+    // First level from values
+    ImVector<ImVec2>& level0 = Levels[0];
+    level0.resize((values_count + 3) / 4);
+    for (int block_n = dirty_begin; block_n < level0.Size; block_n++)
+    {
+        float v_min = FLT_MAX;
+        float v_max = -FLT_MAX;
+        for (int idx = block_n * 4, idx_end = ImMin(idx + 4, values_count); idx < idx_end; idx++)
+        {
+            const float v = GetValue(idx);
+            if (v != v) // Ignore NaN values
+                continue;
+            v_min = ImMin(v_min, v);
+            v_max = ImMax(v_max, v);
+        }
+        level0.Data[block_n] = ImVec2(v_min, v_max);
+    }
+
+    // Upper levels from lower levels
+    for (int level_n = 1; level_n < IM_ARRAYSIZE(Levels) && Levels[level_n - 1].Size > 1; level_n++)
+    {
+        const ImVector<ImVec2>& src = Levels[level_n - 1];
+        ImVector<ImVec2>& dst = Levels[level_n];
+        dirty_begin /= 4;
+        dst.resize((src.Size + 3) / 4);
+        for (int block_n = dirty_begin; block_n < dst.Size; block_n++)
+        {
+            ImVec2 min_max(FLT_MAX, -FLT_MAX);
+            for (int n = block_n * 4, n_end = ImMin(n + 4, src.Size); n < n_end; n++)
+                min_max = ImVec2(ImMin(min_max.x, src.Data[n].x), ImMax(min_max.y, src.Data[n].y));
+            dst.Data[block_n] = min_max;
+        }
+    }
+}
+
+// Process unaligned items at both ends of the range, then move up one level where the remaining range is made of complete blocks.
+bool ImGuiPlotMinMaxCache::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    for (; idx_begin < idx_end && (idx_begin & 3) != 0; idx_begin++)
+    {
+        const float v = GetValue(idx_begin);
+        if (v == v) // Ignore NaN values
+            v_min = ImMin(v_min, v), v_max = ImMax(v_max, v);
+    }
+    for (; idx_begin < idx_end && (idx_end & 3) != 0; idx_end--)
+    {
+        const float v = GetValue(idx_end - 1);
+        if (v == v)
+            v_min = ImMin(v_min, v), v_max = ImMax(v_max, v);
+    }
+    idx_begin /= 4;
+    idx_end /= 4;
+    for (int level_n = 0; idx_begin < idx_end; level_n++)
+    {
+        const ImVec2* level = Levels[level_n].Data;
+        const bool is_last_level = (level_n + 1 == IM_ARRAYSIZE(Levels));
+        for (; idx_begin < idx_end && ((idx_begin & 3) != 0 || is_last_level); idx_begin++)
+            v_min = ImMin(v_min, level[idx_begin].x), v_max = ImMax(v_max, level[idx_begin].y);
+        for (; idx_begin < idx_end && (idx_end & 3) != 0; idx_end--)
+            v_min = ImMin(v_min, level[idx_end - 1].x), v_max = ImMax(v_max, level[idx_end - 1].y);
+        idx_begin /= 4;
+        idx_end /= 4;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, const ImGuiPlotMinMaxCache* minmax_cache, int minmax_cache_start)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -7098,13 +7367,20 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (minmax_cache != NULL)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            minmax_cache->GetMinMax(minmax_cache_start, minmax_cache_start + values_count, &v_min, &v_max);
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -7148,30 +7424,77 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
+        const int columns_count = ImMax((int)inner_bb.GetWidth(), 1);
+        if (minmax_cache != NULL && values_count > columns_count * 2)
         {
-            const float t1 = t0 + t_step;
-            const int v1_idx = (int)(t0 * item_count + 0.5f);
-            IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
-            const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
-
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-            ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-            ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
+            // Draw min/max envelope of values covered by each pixel column
+            const float column_w = inner_bb.GetWidth() / (float)columns_count;
+            float prev_t_max = 0.0f, prev_t_min = 0.0f;
+            bool prev_valid = false;
+            for (int n = 0; n < columns_count; n++)
             {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                const int idx_begin = (int)((ImS64)values_count * n / columns_count);
+                const int idx_end = (int)((ImS64)values_count * (n + 1) / columns_count);
+                float v_min, v_max;
+                if (!minmax_cache->GetMinMax(minmax_cache_start + idx_begin, minmax_cache_start + idx_end, &v_min, &v_max))
+                {
+                    prev_valid = false;
+                    continue;
+                }
+                float t_max = 1.0f - ImSaturate((v_max - scale_min) * inv_scale);   // Top of column in the normalized space of our target rectangle
+                float t_min = 1.0f - ImSaturate((v_min - scale_min) * inv_scale);   // Bottom of column
+                const ImU32 col = (idx_hovered >= idx_begin && idx_hovered < idx_end) ? col_hovered : col_base;
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    // Extend column to reach previous one, so the envelope is connected
+                    const float t_max_unextended = t_max, t_min_unextended = t_min;
+                    if (prev_valid)
+                    {
+                        t_max = ImMin(t_max, prev_t_min);
+                        t_min = ImMax(t_min, prev_t_max);
+                    }
+                    prev_t_max = t_max_unextended;
+                    prev_t_min = t_min_unextended;
+                    prev_valid = true;
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    t_max = ImMin(t_max, histogram_zero_line_t);
+                    t_min = ImMax(t_min, histogram_zero_line_t);
+                }
+                const float x0 = inner_bb.Min.x + column_w * n;
+                const float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_max);
+                const float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_min);
+                window->DrawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x0 + ImMax(column_w, 1.0f), ImMax(y1, y0 + 1.0f)), col);
             }
-            else if (plot_type == ImGuiPlotType_Histogram)
+        }
+        else
+        {
+            for (int n = 0; n < res_w; n++)
             {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
+                const float t1 = t0 + t_step;
+                const int v1_idx = (int)(t0 * item_count + 0.5f);
+                IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
+                const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
+                const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+
+                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
+                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    if (pos1.x >= pos0.x + 2.0f)
+                        pos1.x -= 1.0f;
+                    window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
 
-            t0 = t1;
-            tp0 = tp1;
+                t0 = t1;
+                tp0 = tp1;
+            }
         }
     }
 
@@ -7224,6 +7547,25 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+static void PlotMinMaxCacheEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotMinMaxCache* values, int values_start, int values_count, const char* overlay_text, float scale_min, float scale_max, const ImVec2& graph_size)
+{
+    if (values_count < 0)
+        values_count = values->ValuesCount - values_start;
+    IM_ASSERT(values_start >= 0 && values_count >= 0 && values_start + values_count <= values->ValuesCount);
+    ImGuiPlotArrayGetterData data((const float*)(const void*)((const unsigned char*)values->Values + (size_t)values_start * values->Stride), values->Stride);
+    ImGui::PlotEx(plot_type, label, &Plot_ArrayGetter, (void*)&data, values_count, 0, overlay_text, scale_min, scale_max, graph_size, values, values_start);
+}
+
+void ImGui::PlotLines(const char* label, const ImGuiPlotMinMaxCache* values, int values_start, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotMinMaxCacheEx(ImGuiPlotType_Lines, label, values, values_start, values_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotMinMaxCache* values, int values_start, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotMinMaxCacheEx(ImGuiPlotType_Histogram, label, values, values_start, values_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.